@@ -9,6 +9,7 @@
 
 #include "TimeIntegration.h"
 #include "utility/Parameters.h"
+#include "utility/Profiler.h"
 #include "Domain.h"
 
 // ==================================== Constructor ====================================
@@ -25,16 +26,35 @@ TimeIntegration::TimeIntegration(SolverController *sc) {
     m_dt = params->get_real("physical_parameters/dt");
     m_t_end = params->get_real("physical_parameters/t_end");
     m_t_cur = m_dt;        // since t=0 already handled in setup
+    m_iteration_step = 1;
+    m_restarted = false;
 
     m_solver_controller = sc;
     m_field_controller = m_solver_controller->get_field_controller();
 
     m_adaption = new Adaption(m_field_controller);
+    // created before any solver stage runs on a thread of the task pool
+    m_profiler = Profiler::getInstance();
 #ifndef BENCHMARKING
     m_solution = new Solution();
     m_analysis = new Analysis(m_solution);
     m_visual = new Visual(m_solution);
 #endif
+    m_checkpoint = new Checkpoint(m_field_controller);
+}
+
+// ==================================== Restart ====================================
+// ***************************************************************************************
+/// \brief  continues the simulation with the time step after the checkpoint
+/// \param  filename  checkpoint file
+// ***************************************************************************************
+void TimeIntegration::restart(const std::string &filename) {
+    size_t iteration_step;
+    real t_cur;
+    m_checkpoint->restart(filename, &iteration_step, &t_cur);
+    m_iteration_step = iteration_step + 1;
+    m_t_cur = m_iteration_step * m_dt;
+    m_restarted = true;
 }
 
 void TimeIntegration::run() {
@@ -75,8 +95,10 @@ void TimeIntegration::run() {
 #pragma acc update host(d_C[:bsize])
 #pragma acc update host(d_nu_t[:bsize])
 #pragma acc update host(d_S_T[:bsize]) wait    // all in one update does not work!
-    m_analysis->analyse(m_field_controller, 0.);
-    m_visual->visualise(m_field_controller, 0.);
+    if (!m_restarted) {
+        m_analysis->analyse(m_field_controller, 0.);
+        m_visual->visualise(m_field_controller, 0.);
+    }
     m_logger->info("Start calculating and timing...");
 #else
     std::cout << "Start calculating and timing...\n" << std::endl;
@@ -95,20 +117,25 @@ void TimeIntegration::run() {
         Sum[0] = Sumu, Sum[1] = Sump, Sum[2] = SumT;
 #endif
 
-        int iteration_step = 1;
-        // std::ofstream file;
-        // file.open(adaption->get_write_runtime_name(), ios::app);
-        // std::chrono::time_point<std::chrono::system_clock> iter_start, iter_end;
+        size_t iteration_step = m_iteration_step;
         while (t_cur < t_end + dt / 2) {
-            //iter_start = std::chrono::system_clock::now();
+            m_profiler->begin_step(iteration_step, t_cur);
 #ifndef BENCHMARKING
             m_logger->info("t_cur = {:.5f}", t_cur);
 #endif
 
             // Calculate
             m_solver_controller->solver_do_step(t_cur, false);
+#ifdef _OPENACC
+            // the solver exchanges the buffers of u and u_tmp (FieldController::rotate_vector), hence refresh the
+            // pointers of the host updates
+            d_u = u->data;
+            d_v = v->data;
+            d_w = w->data;
+#endif
 #ifndef BENCHMARKING
             // Visualize
+            Profiler::Scope stage(Stage::VISUALISATION);
 #pragma acc update host(d_u[:bsize])
 #pragma acc update host(d_v[:bsize])
 #pragma acc update host(d_w[:bsize])
@@ -143,6 +170,7 @@ void TimeIntegration::run() {
             // bool VN_check = ana.check_time_step_VN(u, dt);
             // if(!VN_check)
             //     std::cout<<"Von Neumann condition not met!"<<std::endl;
+            stage.stop();
 #endif
             // update
             m_adaption->run(t_cur);
@@ -154,13 +182,13 @@ void TimeIntegration::run() {
             m_solver_controller->update_sources(t_cur, false);
             m_field_controller->update_data(false);
 
-            // iter_end = std::chrono::system_clock::now();
-            // long ms = std::chrono::duration_cast<std::chrono::microseconds>(iter_end - iter_start).count();
-            // file << "t_cur: "<<t_cur << " runtime: " << ms << " microsec\n";
+            m_profiler->end_step();
+            if (m_checkpoint->is_due(iteration_step)) {
+                m_checkpoint->write(iteration_step, t_cur);
+            }
             iteration_step++;
             t_cur = iteration_step * dt;
         }
-        // file.close();
         // Sum up RMS error
 #ifndef BENCHMARKING
         m_analysis->calc_RMS_error(Sum[0], Sum[1], Sum[2]);
@@ -202,5 +230,7 @@ void TimeIntegration::run() {
 #else
     std::cout << "Global Time: " << ms << "ms" << std::endl;
 #endif
+    m_profiler->summarize();
+    delete m_checkpoint;
     delete m_adaption;
 }
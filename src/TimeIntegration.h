@@ -12,6 +12,8 @@
 #include "utility/GlobalMacrosTypes.h"
 #include "solver/SolverController.h"
 #include "adaption/Adaption.h"
+#include "utility/Checkpoint.h"
+#include "utility/Profiler.h"
 
 #ifndef BENCHMARKING
 #include "analysis/Analysis.h"
@@ -25,16 +27,21 @@
 class TimeIntegration {
 public:
     explicit TimeIntegration(SolverController *sc);
+    void restart(const std::string &filename);
     void run();
 
 private:
     real m_dt;
     real m_t_end;
     real m_t_cur;
+    size_t m_iteration_step;
+    bool m_restarted;
 
     FieldController *m_field_controller;
     SolverController *m_solver_controller;
     Adaption *m_adaption;
+    Profiler *m_profiler;
+    Checkpoint *m_checkpoint;
 #ifndef BENCHMARKING
     Visual *m_visual;
     Solution *m_solution;
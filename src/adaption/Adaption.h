@@ -23,8 +23,6 @@ enum class ADTypes : size_t {
     NO = 0, UNKNOWN = 1, YES = 2
 };
 
-class Field;
-
 class IAdaptionFunction;
 
 class Adaption {
@@ -0,0 +1,331 @@
+/// \file       MacCormackAdvect.cpp
+/// \brief      Solves advection equation via semi-Lagrangian MacCormack scheme (second order)
+/// \date       Oct 17, 2026
+/// \author     ARTSS developers
+/// \copyright  <2015-2020> Forschungszentrum Juelich GmbH. All rights reserved.
+
+//==================================== MacCormack Advection ======================================
+// ***************************************************************************************
+/// \brief  solves advection \f$ \partial_t \phi_1 = - (u \cdot \nabla) \phi_0 \f$ via
+///         \f$ \hat\phi = SL(\phi_0) \f$, \f$ \tilde\phi = SL^{-1}(\hat\phi) \f$ and
+///         \f$ \phi_1 = \hat\phi + (\phi_0 - \tilde\phi)/2 \f$ (Selle et al., 2008)
+// ***************************************************************************************
+
+#include <cmath>
+
+#ifdef _OPENACC
+#include <accelmath.h>
+#endif
+
+#include <algorithm>
+#include "MacCormackAdvect.h"
+#include "../utility/Parameters.h"
+#include "../boundary/BoundaryController.h"
+#include "../Domain.h"
+
+namespace {
+// index range of the interpolation (inner cells and one layer of ghost cells)
+struct Box {
+    long int x0, x1, y0, y1, z0, z1;
+};
+
+// ***************************************************************************************
+/// \brief  lower cell index and weight of a position in one direction, positions outside
+///         of the range are moved to its border
+/// \param  p     position in index coordinates
+/// \param  lo    first index
+/// \param  hi    last index
+// ***************************************************************************************
+#pragma acc routine seq
+inline void locate(real p, long int lo, long int hi, long int &i0, real &r) {
+    p = std::min(std::max(p, static_cast<real>(lo)), static_cast<real>(hi));
+    i0 = std::min(static_cast<long int>(p), hi - 1);  // p >= lo >= 0, truncation is floor
+    r = p - static_cast<real>(i0);
+}
+
+// ***************************************************************************************
+/// \brief  trilinear interpolation at a position given in index coordinates
+/// \param  d       field to interpolate
+/// \param  x, y, z position
+/// \param  box     index range
+// ***************************************************************************************
+#pragma acc routine seq
+inline real interpolate(const real *d, real x, real y, real z, const Box &box, size_t Nx, size_t Ny) {
+    long int i0, j0, k0;
+    real r, s, t;
+    locate(x, box.x0, box.x1, i0, r);
+    locate(y, box.y0, box.y1, j0, s);
+    locate(z, box.z0, box.z1, k0, t);
+    const size_t idx = IX(i0, j0, k0, Nx, Ny);
+    const size_t nx = 1;
+    const size_t ny = Nx;
+    const size_t nz = Nx * Ny;
+    return (1. - t) * ((1. - s) * ((1. - r) * d[idx] + r * d[idx + nx])
+                            + s * ((1. - r) * d[idx + ny] + r * d[idx + ny + nx]))
+                + t * ((1. - s) * ((1. - r) * d[idx + nz] + r * d[idx + nz + nx])
+                            + s * ((1. - r) * d[idx + nz + ny] + r * d[idx + nz + ny + nx]));
+}
+
+// ***************************************************************************************
+/// \brief  range of the eight cells used by the interpolation at a position
+/// \param  d       field
+/// \param  x, y, z position
+/// \param  box     index range
+// ***************************************************************************************
+#pragma acc routine seq
+inline void range(const real *d, real x, real y, real z, const Box &box, size_t Nx, size_t Ny, real &f_min, real &f_max) {
+    long int i0, j0, k0;
+    real r, s, t;
+    locate(x, box.x0, box.x1, i0, r);
+    locate(y, box.y0, box.y1, j0, s);
+    locate(z, box.z0, box.z1, k0, t);
+    const size_t idx = IX(i0, j0, k0, Nx, Ny);
+    const size_t ny = Nx;
+    const size_t nz = Nx * Ny;
+    f_min = std::min(std::min(std::min(d[idx], d[idx + 1]), std::min(d[idx + ny], d[idx + ny + 1])),
+                     std::min(std::min(d[idx + nz], d[idx + nz + 1]), std::min(d[idx + nz + ny], d[idx + nz + ny + 1])));
+    f_max = std::max(std::max(std::max(d[idx], d[idx + 1]), std::max(d[idx + ny], d[idx + ny + 1])),
+                     std::max(std::max(d[idx + nz], d[idx + nz + 1]), std::max(d[idx + nz + ny], d[idx + nz + ny + 1])));
+}
+}
+
+// ==================================== Constructor ====================================
+// ***************************************************************************************
+MacCormackAdvect::MacCormackAdvect() {
+    auto params = Parameters::getInstance();
+    m_dt = params->get_real("physical_parameters/dt");
+
+    m_dep_x = new Field(FieldType::U, 0.0);
+    m_dep_y = new Field(FieldType::V, 0.0);
+    m_dep_z = new Field(FieldType::W, 0.0);
+    m_arr_x = new Field(FieldType::U, 0.0);
+    m_arr_y = new Field(FieldType::V, 0.0);
+    m_arr_z = new Field(FieldType::W, 0.0);
+    m_pred = new Field(FieldType::U, 0.0);
+
+    auto d_dep_x = m_dep_x->data;
+    auto d_dep_y = m_dep_y->data;
+    auto d_dep_z = m_dep_z->data;
+    auto d_arr_x = m_arr_x->data;
+    auto d_arr_y = m_arr_y->data;
+    auto d_arr_z = m_arr_z->data;
+    auto d_pred = m_pred->data;
+    size_t bsize = Domain::getInstance()->get_size();
+#pragma acc enter data copyin(d_dep_x[:bsize], d_dep_y[:bsize], d_dep_z[:bsize], d_arr_x[:bsize], d_arr_y[:bsize], d_arr_z[:bsize], d_pred[:bsize])
+}
+
+MacCormackAdvect::~MacCormackAdvect() {
+    auto d_dep_x = m_dep_x->data;
+    auto d_dep_y = m_dep_y->data;
+    auto d_dep_z = m_dep_z->data;
+    auto d_arr_x = m_arr_x->data;
+    auto d_arr_y = m_arr_y->data;
+    auto d_arr_z = m_arr_z->data;
+    auto d_pred = m_pred->data;
+    size_t bsize = Domain::getInstance()->get_size();
+#pragma acc exit data delete(d_dep_x[:bsize], d_dep_y[:bsize], d_dep_z[:bsize], d_arr_x[:bsize], d_arr_y[:bsize], d_arr_z[:bsize], d_pred[:bsize])
+
+    delete m_dep_x;
+    delete m_dep_y;
+    delete m_dep_z;
+    delete m_arr_x;
+    delete m_arr_y;
+    delete m_arr_z;
+    delete m_pred;
+}
+
+// ***************************************************************************************
+/// \brief  solves advection \f$ \partial_t \phi_1 = - (u \cdot \nabla) \phi_0 \f$ via
+///         semi-Lagrangian MacCormack scheme
+/// \param  out   output pointer
+/// \param  in    input pointer
+/// \param  u_vel x -velocity
+/// \param  v_vel y -velocity
+/// \param  w_vel z -velocity
+/// \param  sync  synchronization boolean (true=sync (default), false=async)
+// ***************************************************************************************
+void MacCormackAdvect::advect(Field *out, Field *in, const Field *u_vel, const Field *v_vel, const Field *w_vel, bool sync) {
+    trace(u_vel, v_vel, w_vel, false);
+    correct(out, in, sync);
+}
+
+// ***************************************************************************************
+/// \brief  solves advection of three fields with the same velocity (departure points are
+///         computed once)
+/// \param  out_x output pointer of first field
+/// \param  out_y output pointer of second field
+/// \param  out_z output pointer of third field
+/// \param  in_x  input pointer of first field
+/// \param  in_y  input pointer of second field
+/// \param  in_z  input pointer of third field
+/// \param  u_vel x -velocity
+/// \param  v_vel y -velocity
+/// \param  w_vel z -velocity
+/// \param  sync  synchronization boolean (true=sync (default), false=async)
+// ***************************************************************************************
+void MacCormackAdvect::advect_vector(Field *out_x, Field *out_y, Field *out_z, Field *in_x, Field *in_y, Field *in_z,
+                                     const Field *u_vel, const Field *v_vel, const Field *w_vel, bool sync) {
+    trace(u_vel, v_vel, w_vel, false);
+    correct(out_x, in_x, false);
+    correct(out_y, in_y, false);
+    correct(out_z, in_z, sync);
+}
+
+//======================================== Trace ========================================
+// ***************************************************************************************
+/// \brief  computes the departure points of the backward and the forward trace with the
+///         velocity at the midpoint of the trajectory (second order)
+/// \param  u_vel x -velocity
+/// \param  v_vel y -velocity
+/// \param  w_vel z -velocity
+/// \param  sync  synchronization boolean (true=sync (default), false=async)
+// ***************************************************************************************
+void MacCormackAdvect::trace(const Field *u_vel, const Field *v_vel, const Field *w_vel, bool sync) {
+    auto domain = Domain::getInstance();
+
+    // local variables and parameters for GPU
+    size_t bsize = domain->get_size();
+
+    auto d_u_vel = u_vel->data;
+    auto d_v_vel = v_vel->data;
+    auto d_w_vel = w_vel->data;
+    auto d_dep_x = m_dep_x->data;
+    auto d_dep_y = m_dep_y->data;
+    auto d_dep_z = m_dep_z->data;
+    auto d_arr_x = m_arr_x->data;
+    auto d_arr_y = m_arr_y->data;
+    auto d_arr_z = m_arr_z->data;
+
+    auto boundary = BoundaryController::getInstance();
+
+    size_t *d_rStart = boundary->get_innerRuns_start_level_joined();
+    size_t *d_rLen = boundary->get_innerRuns_length_level_joined();
+    size_t bsize_r = boundary->get_innerRuns_level_joined_end(0) + 1;
+
+    const size_t Nx = domain->get_Nx();
+    const size_t Ny = domain->get_Ny();
+
+    const real dt = m_dt;
+    const real dtx = dt / domain->get_dx();
+    const real dty = dt / domain->get_dy();
+    const real dtz = dt / domain->get_dz();
+
+    const Box box = {static_cast<long int> (domain->get_index_x1()) - 1, static_cast<long int> (domain->get_index_x2()) + 1,
+                     static_cast<long int> (domain->get_index_y1()) - 1, static_cast<long int> (domain->get_index_y2()) + 1,
+                     static_cast<long int> (domain->get_index_z1()) - 1, static_cast<long int> (domain->get_index_z2()) + 1};
+
+#pragma omp parallel for
+#pragma acc parallel loop independent present(d_u_vel[:bsize], d_v_vel[:bsize], d_w_vel[:bsize], d_dep_x[:bsize], d_dep_y[:bsize], d_dep_z[:bsize], d_arr_x[:bsize], d_arr_y[:bsize], d_arr_z[:bsize], d_rStart[:bsize_r], d_rLen[:bsize_r]) async
+    for (size_t l = 0; l < bsize_r; ++l) {
+        const size_t first = d_rStart[l];
+        const size_t k = getCoordinateK(first, Nx, Ny);
+        const size_t j = getCoordinateJ(first, Nx, Ny, k);
+        const size_t i_first = getCoordinateI(first, Nx, Ny, j, k);
+        const size_t i_last = i_first + d_rLen[l];
+        const real y = static_cast<real> (j);
+        const real z = static_cast<real> (k);
+#pragma omp simd
+#pragma acc loop independent
+        for (size_t i = i_first; i < i_last; ++i) {
+            const size_t idx = IX(i, j, k, Nx, Ny);
+            const real x = static_cast<real> (i);
+
+            // half step with the velocity of the arrival point
+            const real hx = 0.5 * dtx * d_u_vel[idx];
+            const real hy = 0.5 * dty * d_v_vel[idx];
+            const real hz = 0.5 * dtz * d_w_vel[idx];
+
+            // backward trace with the velocity at the midpoint
+            d_dep_x[idx] = x - dtx * interpolate(d_u_vel, x - hx, y - hy, z - hz, box, Nx, Ny);
+            d_dep_y[idx] = y - dty * interpolate(d_v_vel, x - hx, y - hy, z - hz, box, Nx, Ny);
+            d_dep_z[idx] = z - dtz * interpolate(d_w_vel, x - hx, y - hy, z - hz, box, Nx, Ny);
+
+            // forward trace (reversed time step)
+            d_arr_x[idx] = x + dtx * interpolate(d_u_vel, x + hx, y + hy, z + hz, box, Nx, Ny);
+            d_arr_y[idx] = y + dty * interpolate(d_v_vel, x + hx, y + hy, z + hz, box, Nx, Ny);
+            d_arr_z[idx] = z + dtz * interpolate(d_w_vel, x + hx, y + hy, z + hz, box, Nx, Ny);
+        }
+    }
+
+    if (sync) {
+#pragma acc wait
+    }
+}
+
+//======================================= Correct =======================================
+// ***************************************************************************************
+/// \brief  advects one field with the departure points of the last trace
+/// \param  out   output pointer
+/// \param  in    input pointer
+/// \param  sync  synchronization boolean (true=sync (default), false=async)
+// ***************************************************************************************
+void MacCormackAdvect::correct(Field *out, const Field *in, bool sync) {
+    auto domain = Domain::getInstance();
+
+    // local variables and parameters for GPU
+    size_t bsize = domain->get_size(out->get_level());
+    FieldType type = out->get_type();
+
+    auto d_out = out->data;
+    auto d_in = in->data;
+    auto d_pred = m_pred->data;
+    auto d_dep_x = m_dep_x->data;
+    auto d_dep_y = m_dep_y->data;
+    auto d_dep_z = m_dep_z->data;
+    auto d_arr_x = m_arr_x->data;
+    auto d_arr_y = m_arr_y->data;
+    auto d_arr_z = m_arr_z->data;
+
+    auto boundary = BoundaryController::getInstance();
+
+    size_t *d_rStart = boundary->get_innerRuns_start_level_joined();
+    size_t *d_rLen = boundary->get_innerRuns_length_level_joined();
+    size_t bsize_r = boundary->get_innerRuns_level_joined_end(0) + 1;
+
+    const size_t Nx = domain->get_Nx(out->get_level());
+    const size_t Ny = domain->get_Ny(out->get_level());
+
+    const Box box = {static_cast<long int> (domain->get_index_x1()) - 1, static_cast<long int> (domain->get_index_x2()) + 1,
+                     static_cast<long int> (domain->get_index_y1()) - 1, static_cast<long int> (domain->get_index_y2()) + 1,
+                     static_cast<long int> (domain->get_index_z1()) - 1, static_cast<long int> (domain->get_index_z2()) + 1};
+
+#pragma acc data present(d_out[:bsize], d_in[:bsize], d_pred[:bsize], d_dep_x[:bsize], d_dep_y[:bsize], d_dep_z[:bsize], d_arr_x[:bsize], d_arr_y[:bsize], d_arr_z[:bsize], d_rStart[:bsize_r], d_rLen[:bsize_r])
+    {
+        // first order prediction (semi-Lagrangian step)
+#pragma omp parallel for
+#pragma acc parallel loop independent present(d_in[:bsize], d_pred[:bsize], d_dep_x[:bsize], d_dep_y[:bsize], d_dep_z[:bsize], d_rStart[:bsize_r], d_rLen[:bsize_r]) async
+        for (size_t l = 0; l < bsize_r; ++l) {
+            const size_t first = d_rStart[l];
+            const size_t i_last = first + d_rLen[l];
+#pragma omp simd
+#pragma acc loop independent
+            for (size_t idx = first; idx < i_last; ++idx) {
+                d_pred[idx] = interpolate(d_in, d_dep_x[idx], d_dep_y[idx], d_dep_z[idx], box, Nx, Ny);
+            }
+        }
+        boundary->applyBoundary(d_pred, type, false);
+
+        // error estimate by the reversed step and limited correction
+#pragma omp parallel for
+#pragma acc parallel loop independent present(d_out[:bsize], d_in[:bsize], d_pred[:bsize], d_dep_x[:bsize], d_dep_y[:bsize], d_dep_z[:bsize], d_arr_x[:bsize], d_arr_y[:bsize], d_arr_z[:bsize], d_rStart[:bsize_r], d_rLen[:bsize_r]) async
+        for (size_t l = 0; l < bsize_r; ++l) {
+            const size_t first = d_rStart[l];
+            const size_t i_last = first + d_rLen[l];
+#pragma omp simd
+#pragma acc loop independent
+            for (size_t idx = first; idx < i_last; ++idx) {
+                const real back = interpolate(d_pred, d_arr_x[idx], d_arr_y[idx], d_arr_z[idx], box, Nx, Ny);
+                real f_min, f_max;
+                range(d_in, d_dep_x[idx], d_dep_y[idx], d_dep_z[idx], box, Nx, Ny, f_min, f_max);
+                const real val = d_pred[idx] + 0.5 * (d_in[idx] - back);
+                d_out[idx] = std::min(std::max(val, f_min), f_max);
+            }
+        }
+
+        boundary->applyBoundary(d_out, type, sync);
+
+        if (sync) {
+#pragma acc wait
+        }
+    }// end data region
+}
@@ -0,0 +1,39 @@
+/// \file       MacCormackAdvect.h
+/// \brief      Solves advection equation via semi-Lagrangian MacCormack scheme (second order)
+/// \date       Oct 17, 2026
+/// \author     ARTSS developers
+/// \copyright  <2015-2020> Forschungszentrum Juelich GmbH. All rights reserved.
+
+#ifndef ARTSS_ADVECTION_MACCORMACKADVECT_H_
+#define ARTSS_ADVECTION_MACCORMACKADVECT_H_
+
+#include "../interfaces/IAdvection.h"
+#include "../field/Field.h"
+#include "../utility/GlobalMacrosTypes.h"
+
+/// \brief  semi-Lagrangian advection with midpoint (second order) back trace and MacCormack
+///         correction (BFECC without the third interpolation). The result is limited to the
+///         range of the eight cells around the departure point, hence the scheme is monotone.
+///         Departure points are computed once per velocity and used for all advected fields.
+class MacCormackAdvect : public IAdvection {
+public:
+    MacCormackAdvect();
+    ~MacCormackAdvect() override;
+
+    void advect(Field *out, Field *in, const Field *u_vel, const Field *v_vel, const Field *w_vel, bool sync) override;
+    void advect_vector(Field *out_x, Field *out_y, Field *out_z, Field *in_x, Field *in_y, Field *in_z,
+                       const Field *u_vel, const Field *v_vel, const Field *w_vel, bool sync) override;
+
+private:
+    void trace(const Field *u_vel, const Field *v_vel, const Field *w_vel, bool sync);
+    void correct(Field *out, const Field *in, bool sync);
+
+    real m_dt;
+    // departure points of the backward (dep) and forward (arr) trace in index coordinates
+    Field *m_dep_x, *m_dep_y, *m_dep_z;
+    Field *m_arr_x, *m_arr_y, *m_arr_z;
+    // first order prediction
+    Field *m_pred;
+};
+
+#endif /* ARTSS_ADVECTION_MACCORMACKADVECT_H_ */
@@ -22,6 +22,42 @@
 #include "../boundary/BoundaryController.h"
 #include "../Domain.h"
 
+namespace {
+// ***************************************************************************************
+/// \brief  departure cells and interpolation weight of the back trace in one direction
+/// \param  C       Courant number (dt * vel / dx)
+/// \param  i       index of the arrival cell
+/// \param  i_start first inner index
+/// \param  i_end   last inner index
+// ***************************************************************************************
+#pragma acc routine seq
+inline void back_trace(real C, long int i, long int i_start, long int i_end, long int &i0, long int &i1, real &r) {
+    if (C > 0) {
+        i0 = std::max(i_start, (i - static_cast<long int>(C)));
+        i1 = i0 - 1;
+        r = fabs(fmod(C, 1));
+    } else {
+        i1 = std::min(i_end, i - static_cast<long int>(C));
+        i0 = i1 + 1;
+        r = 1 - fabs(fmod(C, 1));
+    }
+}
+
+// ***************************************************************************************
+/// \brief  trilinear interpolation at the departure point
+/// \param  d_in   field to interpolate
+/// \param  idx    indices of the eight surrounding cells (000, 100, 010, 110, 001, 101, 011, 111)
+/// \param  r, s, t interpolation weights in x-, y- and z-direction
+// ***************************************************************************************
+#pragma acc routine seq
+inline real trilinear(const real *d_in, const size_t *idx, real r, real s, real t) {
+    return (1. - t) * ((1. - s) * ((1. - r) * d_in[idx[0]] + r * d_in[idx[1]])
+                            + s * ((1. - r) * d_in[idx[2]] + r * d_in[idx[3]]))
+                + t * ((1. - s) * ((1. - r) * d_in[idx[4]] + r * d_in[idx[5]])
+                            + s * ((1. - r) * d_in[idx[6]] + r * d_in[idx[7]])); // row-major
+}
+}
+
 // ==================================== Constructor ====================================
 // ***************************************************************************************
 SLAdvect::SLAdvect() {
@@ -54,8 +90,9 @@ void SLAdvect::advect(Field *out, Field *in, const Field *u_vel, const Field *v_
 
     auto boundary = BoundaryController::getInstance();
 
-    auto bsize_i = boundary->getSize_innerList();
-    size_t *d_iList = boundary->get_innerList_level_joined();
+    size_t *d_rStart = boundary->get_innerRuns_start_level_joined();
+    size_t *d_rLen = boundary->get_innerRuns_length_level_joined();
+    size_t bsize_r = boundary->get_innerRuns_level_joined_end(0) + 1;
 
 #pragma acc data present(d_out[:bsize], d_in[:bsize], d_u_vel[:bsize], d_v_vel[:bsize], d_w_vel[:bsize])
     {
@@ -84,95 +121,197 @@ void SLAdvect::advect(Field *out, Field *in, const Field *u_vel, const Field *v_
         long int j_end = static_cast<long int> (domain->get_index_y2());
         long int k_end = static_cast<long int> (domain->get_index_z2());
 
-#pragma acc parallel loop independent present(d_out[:bsize], d_in[:bsize], d_u_vel[:bsize], d_v_vel[:bsize], d_w_vel[:bsize], d_iList[:bsize_i]) async
-        for (size_t l = 0; l < bsize_i; ++l) {
-            const size_t idx = d_iList[l];
-            const long int k = static_cast<long int> (getCoordinateK(idx, Nx, Ny));
-            const long int j = static_cast<long int> (getCoordinateJ(idx, Nx, Ny, k));
-            const long int i = static_cast<long int> (getCoordinateI(idx, Nx, Ny, j, k));
-
-            // TODO: backtracking may be outside the computational region, it is not a reasonable solution to cut the vector; idea: enlarge ghost cell to CFL*dx
-            // Linear Trace Back
-            real Ci = dtx * d_u_vel[idx];
-            real Cj = dty * d_v_vel[idx];
-            real Ck = dtz * d_w_vel[idx];
-
-            // Calculation of horizontal indices and interpolation weights
-            long int i0;
-            long int i1;
-            real r;
-
-            if (Ci > 0) {
-                i0 = std::max(i_start, (i - static_cast<long int>(Ci)));
-                i1 = i0 - 1;
-                r = fabs(fmod(Ci, 1));
-            } else {
-                i1 = std::min(i_end, i - static_cast<long int>(Ci));
-                i0 = i1 + 1;
-                r = 1 - fabs(fmod(Ci, 1));
+        if (!boundary->hasObstacles()) {
+            // inner cells form a dense box, iterate structured without index list
+#pragma omp parallel for collapse(2)
+#pragma acc parallel loop independent collapse(3) present(d_out[:bsize], d_in[:bsize], d_u_vel[:bsize], d_v_vel[:bsize], d_w_vel[:bsize]) async
+            for (long int k = k_start; k <= k_end; ++k) {
+                for (long int j = j_start; j <= j_end; ++j) {
+                    for (long int i = i_start; i <= i_end; ++i) {
+                        const size_t idx = IX(i, j, k, Nx, Ny);
+
+                        // TODO: backtracking may be outside the computational region, it is not a reasonable solution to cut the vector; idea: enlarge ghost cell to CFL*dx
+                        // Linear Trace Back
+                        long int i0, i1, j0, j1, k0, k1;
+                        real r, s, t;
+                        back_trace(dtx * d_u_vel[idx], i, i_start, i_end, i0, i1, r);
+                        back_trace(dty * d_v_vel[idx], j, j_start, j_end, j0, j1, s);
+                        back_trace(dtz * d_w_vel[idx], k, k_start, k_end, k0, k1, t);
+
+                        // Trilinear Interpolation
+                        const size_t stencil[8] = {IX(i0, j0, k0, Nx, Ny), IX(i1, j0, k0, Nx, Ny),
+                                                   IX(i0, j1, k0, Nx, Ny), IX(i1, j1, k0, Nx, Ny),
+                                                   IX(i0, j0, k1, Nx, Ny), IX(i1, j0, k1, Nx, Ny),
+                                                   IX(i0, j1, k1, Nx, Ny), IX(i1, j1, k1, Nx, Ny)};
+                        d_out[idx] = trilinear(d_in, stencil, r, s, t);
+                    }
+                }
             }
-
-            // Calculation of vertical indices and interpolation weights
-            long int j0;
-            long int j1;
-            real s;
-
-            if (Cj > 0) {
-                j0 = std::max(j_start, j - static_cast<long int>(Cj));
-                j1 = j0 - 1;
-                s = fabs(fmod(Cj, 1));
-            } else {
-                j1 = std::min(j_end, j - static_cast<long int>(Cj));
-                j0 = j1 + 1;
-                s = 1 - fabs(fmod(Cj, 1));
+        } else {
+            // inner cells as runs of consecutive indices, a run never leaves its row (j, k)
+#pragma omp parallel for
+#pragma acc parallel loop independent present(d_out[:bsize], d_in[:bsize], d_u_vel[:bsize], d_v_vel[:bsize], d_w_vel[:bsize], d_rStart[:bsize_r], d_rLen[:bsize_r]) async
+            for (size_t l = 0; l < bsize_r; ++l) {
+                const size_t first = d_rStart[l];
+                const long int k = static_cast<long int> (getCoordinateK(first, Nx, Ny));
+                const long int j = static_cast<long int> (getCoordinateJ(first, Nx, Ny, k));
+                const long int i_first = static_cast<long int> (getCoordinateI(first, Nx, Ny, j, k));
+                const long int i_last = i_first + static_cast<long int> (d_rLen[l]);
+#pragma acc loop independent
+                for (long int i = i_first; i < i_last; ++i) {
+                    const size_t idx = IX(i, j, k, Nx, Ny);
+
+                    // TODO: backtracking may be outside the computational region, it is not a reasonable solution to cut the vector; idea: enlarge ghost cell to CFL*dx
+                    // Linear Trace Back
+                    long int i0, i1, j0, j1, k0, k1;
+                    real r, s, t;
+                    back_trace(dtx * d_u_vel[idx], i, i_start, i_end, i0, i1, r);
+                    back_trace(dty * d_v_vel[idx], j, j_start, j_end, j0, j1, s);
+                    back_trace(dtz * d_w_vel[idx], k, k_start, k_end, k0, k1, t);
+
+                    // Trilinear Interpolation
+                    const size_t stencil[8] = {IX(i0, j0, k0, Nx, Ny), IX(i1, j0, k0, Nx, Ny),
+                                               IX(i0, j1, k0, Nx, Ny), IX(i1, j1, k0, Nx, Ny),
+                                               IX(i0, j0, k1, Nx, Ny), IX(i1, j0, k1, Nx, Ny),
+                                               IX(i0, j1, k1, Nx, Ny), IX(i1, j1, k1, Nx, Ny)};
+                    d_out[idx] = trilinear(d_in, stencil, r, s, t);
+                }
             }
+        }
 
-            // Calculation of depth indices and interpolation weights
-            long int k0;
-            long int k1;
-            real t;
-
-            if (Ck > 0) {
-                k0 = std::max(k_start, k - static_cast<long int>(Ck));
-                k1 = k0 - 1;
-                t = fabs(fmod(Ck, 1));
-            } else {
-                k1 = std::min(k_end, k - static_cast<long int>(Ck));
-                k0 = k1 + 1;
-                t = 1 - fabs(fmod(Ck, 1));
-            }
+        boundary->applyBoundary(d_out, type, sync);
 
-            // Trilinear Interpolation
-            size_t idx_000 = IX(i0, j0, k0, Nx, Ny);
-            auto d_000 = d_in[idx_000];
+        if (sync) {
+#pragma acc wait
+        }
 
-            size_t idx_100 = IX(i1, j0, k0, Nx, Ny);
-            auto d_100 = d_in[idx_100];
+    }// end data region
+}
 
-            size_t idx_010 = IX(i0, j1, k0, Nx, Ny);
-            auto d_010 = d_in[idx_010];
+// ***************************************************************************************
+/// \brief  solves advection of three fields with the same velocity in one traversal. The back
+///         trace and the interpolation weights are computed once per cell and used for all
+///         three fields (same result as three calls of advect).
+/// \param  out_x output pointer of first field
+/// \param  out_y output pointer of second field
+/// \param  out_z output pointer of third field
+/// \param  in_x  input pointer of first field
+/// \param  in_y  input pointer of second field
+/// \param  in_z  input pointer of third field
+/// \param  u_vel x -velocity
+/// \param  v_vel y -velocity
+/// \param  w_vel z -velocity
+/// \param  sync  synchronization boolean (true=sync (default), false=async)
+// ***************************************************************************************
+void SLAdvect::advect_vector(Field *out_x, Field *out_y, Field *out_z, Field *in_x, Field *in_y, Field *in_z,
+                             const Field *u_vel, const Field *v_vel, const Field *w_vel, bool sync) {
+    auto domain = Domain::getInstance();
 
-            size_t idx_110 = IX(i1, j1, k0, Nx, Ny);
-            auto d_110 = d_in[idx_110];
+    // local variables and parameters for GPU
+    size_t bsize = domain->get_size(out_x->get_level());
+
+    auto d_out_x = out_x->data;
+    auto d_out_y = out_y->data;
+    auto d_out_z = out_z->data;
+    auto d_in_x = in_x->data;
+    auto d_in_y = in_y->data;
+    auto d_in_z = in_z->data;
+    auto d_u_vel = u_vel->data;
+    auto d_v_vel = v_vel->data;
+    auto d_w_vel = w_vel->data;
+
+    auto boundary = BoundaryController::getInstance();
 
-            size_t idx_001 = IX(i0, j0, k1, Nx, Ny);
-            auto d_001 = d_in[idx_001];
+    size_t *d_rStart = boundary->get_innerRuns_start_level_joined();
+    size_t *d_rLen = boundary->get_innerRuns_length_level_joined();
+    size_t bsize_r = boundary->get_innerRuns_level_joined_end(0) + 1;
 
-            size_t idx_101 = IX(i1, j0, k1, Nx, Ny);
-            auto d_101 = d_in[idx_101];
+#pragma acc data present(d_out_x[:bsize], d_out_y[:bsize], d_out_z[:bsize], d_in_x[:bsize], d_in_y[:bsize], d_in_z[:bsize], d_u_vel[:bsize], d_v_vel[:bsize], d_w_vel[:bsize])
+    {
+        const size_t Nx = domain->get_Nx(out_x->get_level());
+        const size_t Ny = domain->get_Ny(out_x->get_level());
+
+        const real dt = m_dt;
+
+        const real rdx = 1. / domain->get_dx(out_x->get_level());
+        const real rdy = 1. / domain->get_dy(out_x->get_level());
+        const real rdz = 1. / domain->get_dz(out_x->get_level());
+
+        const real dtx = dt * rdx;
+        const real dty = dt * rdy;
+        const real dtz = dt * rdz;
 
-            size_t idx_011 = IX(i0, j1, k1, Nx, Ny);
-            auto d_011 = d_in[idx_011];
+        // start indices for computational domain of inner cells
+        long int i_start = static_cast<long int> (domain->get_index_x1());
+        long int j_start = static_cast<long int> (domain->get_index_y1());
+        long int k_start = static_cast<long int> (domain->get_index_z1());
+        long int i_end = static_cast<long int> (domain->get_index_x2());
+        long int j_end = static_cast<long int> (domain->get_index_y2());
+        long int k_end = static_cast<long int> (domain->get_index_z2());
 
-            size_t idx_111 = IX(i1, j1, k1, Nx, Ny);
-            auto d_111 = d_in[idx_111];
-            d_out[idx] = (1. - t) * ((1. - s) * ((1. - r) * d_000 + r * d_100)
-                                          + s * ((1. - r) * d_010 + r * d_110))
-                              + t * ((1. - s) * ((1. - r) * d_001 + r * d_101)
-                                          + s * ((1. - r) * d_011 + r * d_111)); // row-major
+        if (!boundary->hasObstacles()) {
+            // inner cells form a dense box, iterate structured without index list
+#pragma omp parallel for collapse(2)
+#pragma acc parallel loop independent collapse(3) present(d_out_x[:bsize], d_out_y[:bsize], d_out_z[:bsize], d_in_x[:bsize], d_in_y[:bsize], d_in_z[:bsize], d_u_vel[:bsize], d_v_vel[:bsize], d_w_vel[:bsize]) async
+            for (long int k = k_start; k <= k_end; ++k) {
+                for (long int j = j_start; j <= j_end; ++j) {
+                    for (long int i = i_start; i <= i_end; ++i) {
+                        const size_t idx = IX(i, j, k, Nx, Ny);
+
+                        // Linear Trace Back
+                        long int i0, i1, j0, j1, k0, k1;
+                        real r, s, t;
+                        back_trace(dtx * d_u_vel[idx], i, i_start, i_end, i0, i1, r);
+                        back_trace(dty * d_v_vel[idx], j, j_start, j_end, j0, j1, s);
+                        back_trace(dtz * d_w_vel[idx], k, k_start, k_end, k0, k1, t);
+
+                        // Trilinear Interpolation with the same stencil for all fields
+                        const size_t stencil[8] = {IX(i0, j0, k0, Nx, Ny), IX(i1, j0, k0, Nx, Ny),
+                                                   IX(i0, j1, k0, Nx, Ny), IX(i1, j1, k0, Nx, Ny),
+                                                   IX(i0, j0, k1, Nx, Ny), IX(i1, j0, k1, Nx, Ny),
+                                                   IX(i0, j1, k1, Nx, Ny), IX(i1, j1, k1, Nx, Ny)};
+                        d_out_x[idx] = trilinear(d_in_x, stencil, r, s, t);
+                        d_out_y[idx] = trilinear(d_in_y, stencil, r, s, t);
+                        d_out_z[idx] = trilinear(d_in_z, stencil, r, s, t);
+                    }
+                }
+            }
+        } else {
+            // inner cells as runs of consecutive indices, a run never leaves its row (j, k)
+#pragma omp parallel for
+#pragma acc parallel loop independent present(d_out_x[:bsize], d_out_y[:bsize], d_out_z[:bsize], d_in_x[:bsize], d_in_y[:bsize], d_in_z[:bsize], d_u_vel[:bsize], d_v_vel[:bsize], d_w_vel[:bsize], d_rStart[:bsize_r], d_rLen[:bsize_r]) async
+            for (size_t l = 0; l < bsize_r; ++l) {
+                const size_t first = d_rStart[l];
+                const long int k = static_cast<long int> (getCoordinateK(first, Nx, Ny));
+                const long int j = static_cast<long int> (getCoordinateJ(first, Nx, Ny, k));
+                const long int i_first = static_cast<long int> (getCoordinateI(first, Nx, Ny, j, k));
+                const long int i_last = i_first + static_cast<long int> (d_rLen[l]);
+#pragma acc loop independent
+                for (long int i = i_first; i < i_last; ++i) {
+                    const size_t idx = IX(i, j, k, Nx, Ny);
+
+                    // Linear Trace Back
+                    long int i0, i1, j0, j1, k0, k1;
+                    real r, s, t;
+                    back_trace(dtx * d_u_vel[idx], i, i_start, i_end, i0, i1, r);
+                    back_trace(dty * d_v_vel[idx], j, j_start, j_end, j0, j1, s);
+                    back_trace(dtz * d_w_vel[idx], k, k_start, k_end, k0, k1, t);
+
+                    // Trilinear Interpolation with the same stencil for all fields
+                    const size_t stencil[8] = {IX(i0, j0, k0, Nx, Ny), IX(i1, j0, k0, Nx, Ny),
+                                               IX(i0, j1, k0, Nx, Ny), IX(i1, j1, k0, Nx, Ny),
+                                               IX(i0, j0, k1, Nx, Ny), IX(i1, j0, k1, Nx, Ny),
+                                               IX(i0, j1, k1, Nx, Ny), IX(i1, j1, k1, Nx, Ny)};
+                    d_out_x[idx] = trilinear(d_in_x, stencil, r, s, t);
+                    d_out_y[idx] = trilinear(d_in_y, stencil, r, s, t);
+                    d_out_z[idx] = trilinear(d_in_z, stencil, r, s, t);
+                }
+            }
         }
 
-        boundary->applyBoundary(d_out, type, sync);
+        boundary->applyBoundary(d_out_x, out_x->get_type(), sync);
+        boundary->applyBoundary(d_out_y, out_y->get_type(), sync);
+        boundary->applyBoundary(d_out_z, out_z->get_type(), sync);
 
         if (sync) {
 #pragma acc wait
@@ -17,6 +17,8 @@ public:
     ~SLAdvect() override = default;
 
     void advect(Field *out, Field *in, const Field *u_vel, const Field *v_vel, const Field *w_vel, bool sync) override;
+    void advect_vector(Field *out_x, Field *out_y, Field *out_z, Field *in_x, Field *in_y, Field *in_z,
+                       const Field *u_vel, const Field *v_vel, const Field *w_vel, bool sync) override;
 
 private:
     real m_dt;
@@ -8,8 +8,10 @@
 #include <cmath>
 #include <algorithm>
 #include <fstream>
+#include <cstring>
 
 #include "Analysis.h"
+#include "BinaryDatFormat.h"
 #include "../boundary/BoundaryController.h"
 #include "../utility/Parameters.h"
 #include "../Domain.h"
@@ -28,6 +30,7 @@ Analysis::Analysis(Solution *solution) {
         m_logger->info("No analytical solution available!");
 #endif
     }
+    m_binary_output = (params->get("solver/solution/dat_format", "text") == "binary");
     m_solution = solution;
 }
 
@@ -354,7 +357,7 @@ real Analysis::calc_CFL(Field *u, Field *v, Field *w, real dt) {
 
 // =============================== Save variables ==============================
 // *****************************************************************************
-/// \brief  saves variables in .dat files
+/// \brief  saves variables in .dat files (or .bin files, if dat_format="binary")
 /// \param  field_controller    pointer to solver
 // ***************************************************************************************
 void Analysis::save_variables_in_file(FieldController *field_controller) {
@@ -378,7 +381,11 @@ void Analysis::save_variables_in_file(FieldController *field_controller) {
     dataField[FieldType::T] = field_controller->get_field_T_data();
 
     for (auto & v_field : v_fields) {
-        write_file(dataField[v_field], BoundaryData::getFieldTypeName(v_field), innerList, size_innerList, boundaryList, size_boundaryList, obstacleList, size_obstacleList);
+        if (m_binary_output) {
+            write_binary_file(dataField[v_field], BoundaryData::getFieldTypeName(v_field), innerList, size_innerList, boundaryList, size_boundaryList, obstacleList, size_obstacleList);
+        } else {
+            write_file(dataField[v_field], BoundaryData::getFieldTypeName(v_field), innerList, size_innerList, boundaryList, size_boundaryList, obstacleList, size_obstacleList);
+        }
     }
 }
 
@@ -390,26 +397,71 @@ void Analysis::write_file(const real *field, const std::string& filename, size_t
     std::ofstream out_inner;
     out_inner.open(filename + "_inner.dat", std::ofstream::out);
     for (size_t idx = 0; idx < size_inner_list; idx++) {
-        out_inner << inner_list[idx] << ";" << field[inner_list[idx]] << std::endl;
-        out << field[inner_list[idx]] << std::endl;
+        out_inner << inner_list[idx] << ";" << field[inner_list[idx]] << '\n';
+        out << field[inner_list[idx]] << '\n';
     }
     out_inner.close();
 
     std::ofstream out_obstacle;
     out_obstacle.open(filename + "_obstacle.dat", std::ofstream::out);
     for (size_t idx = 0; idx < size_obstacle_list; idx++) {
-        out_obstacle << obstacle_list[idx] << ";" << field[obstacle_list[idx]] << std::endl;
-        out << field[obstacle_list[idx]] << std::endl;
+        out_obstacle << obstacle_list[idx] << ";" << field[obstacle_list[idx]] << '\n';
+        out << field[obstacle_list[idx]] << '\n';
     }
     out_obstacle.close();
 
     std::ofstream out_boundary;
     out_boundary.open(filename + "_boundary.dat", std::ofstream::out);
     for (size_t idx = 0; idx < size_boundary_list; idx++) {
-        out_boundary << boundary_list[idx] << ";" << field[boundary_list[idx]] << std::endl;
-        out << field[boundary_list[idx]] << std::endl;
+        out_boundary << boundary_list[idx] << ";" << field[boundary_list[idx]] << '\n';
+        out << field[boundary_list[idx]] << '\n';
     }
     out_boundary.close();
 
     out.close();
 }
+
+// ***************************************************************************************
+/// \brief  writes the values of <filename>.dat together with the indices of the cells into
+///         <filename>.bin (see BinaryDatFormat.h), which replaces the four .dat files
+// ***************************************************************************************
+void Analysis::write_binary_file(const real *field, const std::string &filename, size_t *inner_list, size_t size_inner_list, size_t *boundary_list, size_t size_boundary_list, size_t *obstacle_list, size_t size_obstacle_list) {
+    BinaryDatFormat::Header header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, BinaryDatFormat::magic, sizeof(header.magic));
+    header.version = BinaryDatFormat::version;
+    header.value_size = sizeof(real);
+    header.size_inner_list = size_inner_list;
+    header.size_obstacle_list = size_obstacle_list;
+    header.size_boundary_list = size_boundary_list;
+
+    size_t size = size_inner_list + size_obstacle_list + size_boundary_list;
+    header.index_offset = BinaryDatFormat::aligned(sizeof(header));
+    header.value_offset = BinaryDatFormat::aligned(header.index_offset + size * sizeof(uint64_t));
+
+    // assemble the whole file and write it at once
+    std::vector<char> buffer(header.value_offset + size * sizeof(real), 0);
+    auto indices = reinterpret_cast<uint64_t *>(buffer.data() + header.index_offset);
+    auto values = reinterpret_cast<real *>(buffer.data() + header.value_offset);
+    BinaryDatFormat::header_to_little_endian(header);
+    std::memcpy(buffer.data(), &header, sizeof(header));
+    size_t counter = 0;
+    for (size_t idx = 0; idx < size_inner_list; idx++, counter++) {
+        indices[counter] = inner_list[idx];
+        values[counter] = field[inner_list[idx]];
+    }
+    for (size_t idx = 0; idx < size_obstacle_list; idx++, counter++) {
+        indices[counter] = obstacle_list[idx];
+        values[counter] = field[obstacle_list[idx]];
+    }
+    for (size_t idx = 0; idx < size_boundary_list; idx++, counter++) {
+        indices[counter] = boundary_list[idx];
+        values[counter] = field[boundary_list[idx]];
+    }
+    BinaryFormat::to_little_endian(indices, size, sizeof(uint64_t));
+    BinaryFormat::to_little_endian(values, size, sizeof(real));
+
+    std::ofstream out(filename + ".bin", std::ofstream::out | std::ofstream::binary);
+    out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    out.close();
+}
@@ -37,8 +37,11 @@ class Analysis {
 
     static void write_file(const real *field, const std::string& filename, size_t *inner_list, size_t size_inner_list, size_t *boundary_list, size_t size_boundary_list, size_t *obstacle_list,
                     size_t size_obstacle_list);
+    static void write_binary_file(const real *field, const std::string& filename, size_t *inner_list, size_t size_inner_list, size_t *boundary_list, size_t size_boundary_list, size_t *obstacle_list,
+                    size_t size_obstacle_list);
 
     bool has_analytic_solution = false;
+    bool m_binary_output = false;
     Solution *m_solution;
 #ifndef BENCHMARKING
     std::shared_ptr<spdlog::logger> m_logger;
@@ -0,0 +1,48 @@
+/// \file       BinaryDatFormat.h
+/// \brief      layout of the binary variant (.bin) of the .dat files written by the analysis
+/// \date       Oct 17, 2026
+/// \author     ARTSS developers
+/// \copyright  <2015-2020> Forschungszentrum Juelich GmbH. All rights reserved.
+
+#ifndef ARTSS_ANALYSIS_BINARYDATFORMAT_H_
+#define ARTSS_ANALYSIS_BINARYDATFORMAT_H_
+
+#include <cstdint>
+
+#include "../utility/BinaryFormat.h"
+
+/// \brief  A binary dump of a field consists of the header, the cell indices (uint64, starting
+///         at index_offset) and the values (value_size bytes each, starting at value_offset).
+///         Indices and values are ordered as in <field>.dat: inner cells, obstacle cells and
+///         boundary cells. All numbers are little endian, both offsets are multiples of alignment,
+///         hence the file can be mapped and the arrays used in place (tools/artss_compare).
+namespace BinaryDatFormat {
+    const char magic[8] = {'A', 'R', 'T', 'S', 'S', 'D', 'A', 'T'};
+    const uint32_t version = 2;
+    const uint64_t alignment = 64;
+
+    struct Header {
+        char magic[8];
+        uint32_t version;
+        uint32_t value_size;
+        uint32_t reserved[2];
+        uint64_t size_inner_list;
+        uint64_t size_obstacle_list;
+        uint64_t size_boundary_list;
+        uint64_t index_offset;
+        uint64_t value_offset;
+    };
+    static_assert(sizeof(Header) == 64, "unexpected padding of the header");
+
+    /// \brief  converts the header of a binary dump to/from little endian
+    inline void header_to_little_endian(Header &header) {
+        BinaryFormat::to_little_endian(&header.version, 2, sizeof(uint32_t));
+        BinaryFormat::to_little_endian(&header.size_inner_list, 5, sizeof(uint64_t));
+    }
+
+    inline uint64_t aligned(uint64_t offset) {
+        return BinaryFormat::aligned(offset, alignment);
+    }
+}
+
+#endif /* ARTSS_ANALYSIS_BINARYDATFORMAT_H_ */
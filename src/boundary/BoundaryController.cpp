@@ -9,6 +9,7 @@
 #include "../Domain.h"
 #include <tuple>
 #include "../utility/Utility.h"
+#include "../utility/Profiler.h"
 #include <algorithm>
 
 BoundaryController *BoundaryController::singleton = nullptr; // Singleton
@@ -200,9 +201,12 @@ void BoundaryController::applyBoundary(real *d, FieldType f, bool sync) {
 /// \param  level       Multigrid level
 /// \param  f           type of output pointer
 /// \param  sync    synchronization (default: false)
+/// \param  homogeneous zero-value boundary conditions also in level 0 (e.g. for corrections)
 // ***************************************************************************************
-void BoundaryController::applyBoundary(real *d, size_t level, FieldType f, bool sync) {
-    m_multigrid->applyBoundaryCondition(d, level, f, sync);
+template<typename T>
+void BoundaryController::applyBoundary(T *d, size_t level, FieldType f, bool sync, bool homogeneous) {
+    Profiler::Scope stage(Stage::BOUNDARY);
+    m_multigrid->applyBoundaryCondition(d, level, f, sync, homogeneous);
 }
 
 size_t BoundaryController::getSize_innerList_level_joined() {
@@ -241,6 +245,26 @@ size_t BoundaryController::get_innerList_level_joined_end(size_t level) {
     return m_multigrid->getInnerList_level_joined_end(level);
 }
 
+size_t *BoundaryController::get_innerRuns_start_level_joined() {
+    return m_multigrid->getInnerRuns_start_level_joined();
+}
+
+size_t *BoundaryController::get_innerRuns_length_level_joined() {
+    return m_multigrid->getInnerRuns_length_level_joined();
+}
+
+size_t BoundaryController::getSize_innerRuns_level_joined() {
+    return m_multigrid->getSize_innerRuns_level_joined();
+}
+
+size_t BoundaryController::get_innerRuns_level_joined_start(size_t level) {
+    return m_multigrid->getInnerRuns_level_joined_start(level);
+}
+
+size_t BoundaryController::get_innerRuns_level_joined_end(size_t level) {
+    return m_multigrid->getInnerRuns_level_joined_end(level);
+}
+
 size_t *BoundaryController::get_boundaryList_level_joined() {
     return m_multigrid->getBoundaryList_level_joined();
 }
@@ -266,3 +290,8 @@ size_t BoundaryController::getObstacleStrideZ(size_t id, size_t level){
 std::vector<FieldType> BoundaryController::get_used_fields() {
     return m_bdc_boundary->get_used_fields();
 }
+
+template void BoundaryController::applyBoundary<real>(real *d, size_t level, FieldType f, bool sync, bool homogeneous);
+#ifdef MIXED_PRECISION
+template void BoundaryController::applyBoundary<real_lp>(real_lp *d, size_t level, FieldType f, bool sync, bool homogeneous);
+#endif
@@ -23,7 +23,8 @@ public:
     ~BoundaryController();
 
     void applyBoundary(real *d, FieldType f, bool sync = true);
-    void applyBoundary(real *d, size_t level, FieldType f, bool sync = true);
+    template<typename T>
+    void applyBoundary(T *d, size_t level, FieldType f, bool sync = true, bool homogeneous = false);
     //void applyBoundary(real *d, size_t level, FieldType f, real* val, bool sync = true); // for non-const BC
 
     void printBoundaries();
@@ -39,18 +40,28 @@ public:
     size_t get_innerList_level_joined_start(size_t level);
     size_t get_innerList_level_joined_end(size_t level);
 
+    // inner cells compressed into runs (start index, length) of consecutive indices per x-row
+    size_t* get_innerRuns_start_level_joined();
+    size_t* get_innerRuns_length_level_joined();
+    size_t getSize_innerRuns_level_joined();
+    size_t get_innerRuns_level_joined_start(size_t level);
+    size_t get_innerRuns_level_joined_end(size_t level);
+
     size_t* get_boundaryList_level_joined();
     size_t getSize_boundaryList_level_joined(); //TODO necessary?
     size_t get_boundaryList_level_joined_start(size_t level);
     size_t get_boundaryList_level_joined_end(size_t level);
 
     size_t getSize_surfaceList() {return m_size_sList;};
+    bool hasObstacles() {return m_numberOfObstacles > 0;};  // without obstacles inner cells form one dense box
+    bool hasSurfaces() {return m_numberOfSurfaces > 0;};
 
     size_t getObstacleStrideX(size_t id, size_t level);
     size_t getObstacleStrideY(size_t id, size_t level);
     size_t getObstacleStrideZ(size_t id, size_t level);
 
     std::vector<FieldType> get_used_fields();
+    BoundaryData* get_domain_boundary_data(FieldType f) {return m_bdc_boundary->get_boundary_data(f);};
 
 private:
 #ifndef BENCHMARKING
@@ -76,10 +76,12 @@ void BoundaryDataController::print() {
 /// \param  fieldType Type of field
 /// \param  level Multigrid level
 /// \param  sync synchronous kernel launching (true, default: false)
+/// \param  homogeneous zero-value boundary conditions also in level 0 (default: false)
 // ***************************************************************************************
-void BoundaryDataController::applyBoundaryCondition(real *data, size_t **indexFields, size_t *patch_start, size_t *patch_end, FieldType fieldType, size_t level, bool sync) {
+template<typename T>
+void BoundaryDataController::applyBoundaryCondition(T *data, size_t **indexFields, size_t *patch_start, size_t *patch_end, FieldType fieldType, size_t level, bool sync, bool homogeneous) {
     if (!((BoundaryData *) *(m_boundaryData + fieldType))->isEmpty()) {
-        DomainBoundary::apply_boundary_condition(data, indexFields, patch_start, patch_end, level, m_boundaryData[fieldType], sync);
+        DomainBoundary::apply_boundary_condition(data, indexFields, patch_start, patch_end, level, m_boundaryData[fieldType], sync, homogeneous);
     }
 }
 
@@ -94,10 +96,12 @@ void BoundaryDataController::applyBoundaryCondition(real *data, size_t **indexFi
 /// \param  level Multigrid level
 /// \param  id ID of obstacle
 /// \param  sync synchronous kernel launching (true, default: false)
+/// \param  homogeneous zero-value boundary conditions also in level 0 (default: false)
 // ***************************************************************************************
-void BoundaryDataController::applyBoundaryConditionObstacle(real *data, size_t **indexFields, size_t *patch_start, size_t *patch_end, FieldType fieldType, size_t level, size_t id, bool sync) {
+template<typename T>
+void BoundaryDataController::applyBoundaryConditionObstacle(T *data, size_t **indexFields, size_t *patch_start, size_t *patch_end, FieldType fieldType, size_t level, size_t id, bool sync, bool homogeneous) {
     if (!((BoundaryData *) *(m_boundaryData + fieldType))->isEmpty()) {
-        ObstacleBoundary::apply_boundary_condition(data, indexFields, patch_start, patch_end, level, m_boundaryData[fieldType], id, sync);
+        ObstacleBoundary::apply_boundary_condition(data, indexFields, patch_start, patch_end, level, m_boundaryData[fieldType], id, sync, homogeneous);
     }
 }
 
@@ -110,3 +114,10 @@ std::vector<FieldType> BoundaryDataController::get_used_fields() {
     }
     return v_fields;
 }
+
+template void BoundaryDataController::applyBoundaryCondition<real>(real *data, size_t **indexFields, size_t *patch_start, size_t *patch_end, FieldType fieldType, size_t level, bool sync, bool homogeneous);
+template void BoundaryDataController::applyBoundaryConditionObstacle<real>(real *data, size_t **indexFields, size_t *patch_start, size_t *patch_end, FieldType fieldType, size_t level, size_t id, bool sync, bool homogeneous);
+#ifdef MIXED_PRECISION
+template void BoundaryDataController::applyBoundaryCondition<real_lp>(real_lp *data, size_t **indexFields, size_t *patch_start, size_t *patch_end, FieldType fieldType, size_t level, bool sync, bool homogeneous);
+template void BoundaryDataController::applyBoundaryConditionObstacle<real_lp>(real_lp *data, size_t **indexFields, size_t *patch_start, size_t *patch_end, FieldType fieldType, size_t level, size_t id, bool sync, bool homogeneous);
+#endif
@@ -16,13 +16,16 @@ public:
     BoundaryDataController();
     ~BoundaryDataController();
     void addBoundaryData(tinyxml2::XMLElement *xmlElement);
-    void applyBoundaryCondition(real *data, size_t **indexFields, size_t *patch_start, size_t *patch_end, FieldType fieldType, size_t level, bool sync=false);
-    void applyBoundaryConditionObstacle(real *data, size_t **indexFields, size_t *patch_start, size_t *patch_end, FieldType fieldType, size_t level, size_t id, bool sync=false);
+    template<typename T>
+    void applyBoundaryCondition(T *data, size_t **indexFields, size_t *patch_start, size_t *patch_end, FieldType fieldType, size_t level, bool sync=false, bool homogeneous=false);
+    template<typename T>
+    void applyBoundaryConditionObstacle(T *data, size_t **indexFields, size_t *patch_start, size_t *patch_end, FieldType fieldType, size_t level, size_t id, bool sync=false, bool homogeneous=false);
     void print();
 
     //void setIndexFields(size_t** indexFields);
 
     std::vector<FieldType> get_used_fields();
+    BoundaryData* get_boundary_data(FieldType fieldType) { return *(m_boundaryData + fieldType); };
 
 private:
     BoundaryData** m_boundaryData;
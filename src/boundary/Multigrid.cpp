@@ -139,6 +139,7 @@ void Multigrid::init() {
     // start index of each level (difference equals size of respective element)
     m_size_MG_iList_level = new size_t[m_levels + 2];
     m_size_MG_bList_level = new size_t[m_levels + 2];
+    m_size_MG_iRuns_level = new size_t[m_levels + 2];
     m_size_MG_bSliceZ_level = new size_t[m_levels + 2];
     m_size_MG_bSliceY_level = new size_t[m_levels + 2];
     m_size_MG_bSliceX_level = new size_t[m_levels + 2];
@@ -146,6 +147,7 @@ void Multigrid::init() {
     //start index of first element = 0
     *(m_size_MG_iList_level) = 0;
     *(m_size_MG_bList_level) = 0;
+    *(m_size_MG_iRuns_level) = 0;
 
     *(m_size_MG_bSliceZ_level) = 0;
     *(m_size_MG_bSliceY_level) = 0;
@@ -188,10 +190,15 @@ Multigrid::~Multigrid() {
 
     size_t size_iList = getLen_iList_joined();
     size_t size_bList = getLen_bList_joined();
+    size_t size_iRuns = getSize_innerRuns_level_joined();
 #pragma acc exit data delete(m_data_MG_iList_level_joined[:size_iList])
 #pragma acc exit data delete(m_data_MG_bList_level_joined[:size_bList])
+#pragma acc exit data delete(m_data_MG_iRuns_start_level_joined[:size_iRuns])
+#pragma acc exit data delete(m_data_MG_iRuns_length_level_joined[:size_iRuns])
     delete[] m_data_MG_iList_level_joined;
     delete[] m_data_MG_bList_level_joined;
+    delete[] m_data_MG_iRuns_start_level_joined;
+    delete[] m_data_MG_iRuns_length_level_joined;
 
     size_t size_bSliceZ = getLen_bSliceZ_joined();
     size_t size_bSliceY = getLen_bSliceY_joined();
@@ -211,6 +218,7 @@ Multigrid::~Multigrid() {
 
     delete[] m_size_MG_iList_level;
     delete[] m_size_MG_bList_level;
+    delete[] m_size_MG_iRuns_level;
 
     delete[] m_size_MG_bSliceZ_level;
     delete[] m_size_MG_bSliceY_level;
@@ -829,8 +837,13 @@ void Multigrid::sendBoundaryListsToGPU() {
             counter_bSliceX++;
         }
     }
+    calcInnerRuns();
+    size_t size_iRuns = getSize_innerRuns_level_joined();
+
 #pragma acc enter data copyin(m_data_MG_iList_level_joined[:size_iList])
 #pragma acc enter data copyin(m_data_MG_bList_level_joined[:size_bList])
+#pragma acc enter data copyin(m_data_MG_iRuns_start_level_joined[:size_iRuns])
+#pragma acc enter data copyin(m_data_MG_iRuns_length_level_joined[:size_iRuns])
 #pragma acc enter data copyin(m_data_MG_bFront_level_joined[:size_bSliceZ])
 #pragma acc enter data copyin(m_data_MG_bBack_level_joined[:size_bSliceZ])
 #pragma acc enter data copyin(m_data_MG_bTop_level_joined[:size_bSliceY])
@@ -839,6 +852,48 @@ void Multigrid::sendBoundaryListsToGPU() {
 #pragma acc enter data copyin(m_data_MG_bRight_level_joined[:size_bSliceX])
 }
 
+// ================================= Calc inner runs ====================================
+// ***************************************************************************************
+/// \brief  compresses the level joined inner list into runs of consecutive indices
+///         (start index and length per contiguous x-row), level joined as the inner list
+// ***************************************************************************************
+void Multigrid::calcInnerRuns() {
+    // count runs of each level
+    for (size_t level = 0; level < m_levels + 1; level++) {
+        size_t start_i = getFirstIndex_iList(level);
+        size_t end_i = getLastIndex_iList(level) + 1;
+        size_t runs = 0;
+        for (size_t j = start_i; j < end_i; j++) {
+            if (j == start_i || m_data_MG_iList_level_joined[j] != m_data_MG_iList_level_joined[j - 1] + 1) {
+                runs++;
+            }
+        }
+        m_size_MG_iRuns_level[level + 1] = m_size_MG_iRuns_level[level] + runs;
+    }
+
+    size_t size_iRuns = getSize_innerRuns_level_joined();
+    m_data_MG_iRuns_start_level_joined = new size_t[size_iRuns];
+    m_data_MG_iRuns_length_level_joined = new size_t[size_iRuns];
+
+    size_t counter_iRuns = 0;
+    for (size_t level = 0; level < m_levels + 1; level++) {
+        size_t start_i = getFirstIndex_iList(level);
+        size_t end_i = getLastIndex_iList(level) + 1;
+        for (size_t j = start_i; j < end_i; j++) {
+            if (j == start_i || m_data_MG_iList_level_joined[j] != m_data_MG_iList_level_joined[j - 1] + 1) {
+                m_data_MG_iRuns_start_level_joined[counter_iRuns] = m_data_MG_iList_level_joined[j];
+                m_data_MG_iRuns_length_level_joined[counter_iRuns] = 1;
+                counter_iRuns++;
+            } else {
+                m_data_MG_iRuns_length_level_joined[counter_iRuns - 1]++;
+            }
+        }
+    }
+#ifndef BENCHMARKING
+    m_logger->debug("Compressed {} inner cells into {} runs", getLen_iList_joined() - 1, size_iRuns);
+#endif
+}
+
 // ================================= Send surface list to GPU ==========================================
 // ***************************************************************************************
 /// \brief  create surface joined list and send it to GPU
@@ -954,11 +1009,13 @@ void Multigrid::sendObstacleListsToGPU() {
 /// \param  level Multigrid level
 /// \param  f Field type
 /// \param  sync synchronous kernel launching (true, default: false)
+/// \param  homogeneous zero-value boundary conditions also in level 0 (default: false)
 // ***************************************************************************************
-void Multigrid::applyBoundaryCondition(real *d, size_t level, FieldType f, bool sync) {
+template<typename T>
+void Multigrid::applyBoundaryCondition(T *d, size_t level, FieldType f, bool sync, bool homogeneous) {
     size_t patch_start[] = {getFirstIndex_bSliceZ(level), getFirstIndex_bSliceZ(level), getFirstIndex_bSliceY(level), getFirstIndex_bSliceY(level), getFirstIndex_bSliceX(level), getFirstIndex_bSliceX(level)};
     size_t patch_end[] = {getFirstIndex_bSliceZ(level + 1), getFirstIndex_bSliceZ(level + 1), getFirstIndex_bSliceY(level + 1), getFirstIndex_bSliceY(level + 1), getFirstIndex_bSliceX(level + 1), getFirstIndex_bSliceX(level + 1)};
-    m_bdc_boundary->applyBoundaryCondition(d, m_data_boundary_patches_joined, patch_start, patch_end, f, level, sync);
+    m_bdc_boundary->applyBoundaryCondition(d, m_data_boundary_patches_joined, patch_start, patch_end, f, level, sync, homogeneous);
 
     if (m_numberOfSurfaces > 0) {
         Surface **surfaceList = *(m_MG_surfaceList + level);
@@ -971,7 +1028,7 @@ void Multigrid::applyBoundaryCondition(real *d, size_t level, FieldType f, bool
             size_t opatch_start[] = {getFirstIndex_oFront(level, id), getFirstIndex_oBack(level, id), getFirstIndex_oBottom(level, id), getFirstIndex_oTop(level, id), getFirstIndex_oLeft(level, id), getFirstIndex_oRight(level, id),};
             size_t opatch_end[] = {getFirstIndex_oFront(level + 1, id), getFirstIndex_oBack(level + 1, id), getFirstIndex_oBottom(level + 1, id), getFirstIndex_oTop(level + 1, id), getFirstIndex_oLeft(level + 1, id),
                                    getFirstIndex_oRight(level + 1, id),};
-            ((BoundaryDataController *) *(m_bdc_obstacle + id))->applyBoundaryConditionObstacle(d, m_data_obstacles_patches_joined, opatch_start, opatch_end, f, level, id, sync);
+            ((BoundaryDataController *) *(m_bdc_obstacle + id))->applyBoundaryConditionObstacle(d, m_data_obstacles_patches_joined, opatch_start, opatch_end, f, level, id, sync, homogeneous);
         }
     }
 }
@@ -1023,10 +1080,15 @@ void Multigrid::updateLists() {
 void Multigrid::removeBoundaryListsFromGPU(){
     size_t size_iList = getLen_iList_joined();
     size_t size_bList = getLen_bList_joined();
+    size_t size_iRuns = getSize_innerRuns_level_joined();
 #pragma acc exit data delete(m_data_MG_iList_level_joined[:size_iList])
 #pragma acc exit data delete(m_data_MG_bList_level_joined[:size_bList])
+#pragma acc exit data delete(m_data_MG_iRuns_start_level_joined[:size_iRuns])
+#pragma acc exit data delete(m_data_MG_iRuns_length_level_joined[:size_iRuns])
     delete[] m_data_MG_iList_level_joined;
     delete[] m_data_MG_bList_level_joined;
+    delete[] m_data_MG_iRuns_start_level_joined;
+    delete[] m_data_MG_iRuns_length_level_joined;
 
     size_t size_bSliceZ = getLen_bSliceZ_joined();
     size_t size_bSliceY = getLen_bSliceY_joined();
@@ -1620,6 +1682,14 @@ size_t Multigrid::getInnerList_level_joined_end(size_t level) {
     return getInnerList_level_joined_start(level + 1) - 1;
 }
 
+size_t Multigrid::getInnerRuns_level_joined_start(size_t level) {
+    return *(m_size_MG_iRuns_level + level);
+}
+
+size_t Multigrid::getInnerRuns_level_joined_end(size_t level) {
+    return getInnerRuns_level_joined_start(level + 1) - 1;
+}
+
 size_t Multigrid::getBoundaryList_level_joined_start(size_t level) {
     return *(m_size_MG_bList_level + level);
 }
@@ -1639,3 +1709,8 @@ size_t Multigrid::getObstacleStrideY(size_t id, size_t level) {
 size_t Multigrid::getObstacleStrideZ(size_t id, size_t level) {
     return ((Obstacle *) m_MG_obstacleList[level][id])->getStrideZ();
 }
+
+template void Multigrid::applyBoundaryCondition<real>(real *d, size_t level, FieldType f, bool sync, bool homogeneous);
+#ifdef MIXED_PRECISION
+template void Multigrid::applyBoundaryCondition<real_lp>(real_lp *d, size_t level, FieldType f, bool sync, bool homogeneous);
+#endif
@@ -32,6 +32,13 @@ public:
     size_t getInnerList_level_joined_start(size_t level);
     size_t getInnerList_level_joined_end(size_t level);
 
+    // inner cells as runs of consecutive indices (one run per contiguous x-row)
+    size_t* getInnerRuns_start_level_joined() { return m_data_MG_iRuns_start_level_joined; };
+    size_t* getInnerRuns_length_level_joined() { return m_data_MG_iRuns_length_level_joined; };
+    size_t getSize_innerRuns_level_joined() { return *(m_size_MG_iRuns_level + m_levels + 1); };
+    size_t getInnerRuns_level_joined_start(size_t level);
+    size_t getInnerRuns_level_joined_end(size_t level);
+
     size_t* getBoundaryList_level_joined() { return m_data_MG_bList_level_joined; };
     size_t getSize_boundaryList_level_joined() { return *(m_size_MG_bList_level + m_levels + 1); };
     size_t getBoundaryList_level_joined_start(size_t level);
@@ -39,7 +46,8 @@ public:
 
     void updateLists();
 
-    void applyBoundaryCondition(real* d, size_t level, FieldType f, bool sync = false);
+    template<typename T>
+    void applyBoundaryCondition(T* d, size_t level, FieldType f, bool sync = false, bool homogeneous = false);
 
     size_t getObstacleStrideX(size_t id, size_t level);
     size_t getObstacleStrideY(size_t id, size_t level);
@@ -76,6 +84,7 @@ private:
     // start index of each level in level joined list
     size_t* m_size_MG_iList_level;
     size_t* m_size_MG_bList_level;
+    size_t* m_size_MG_iRuns_level;
 
     // start index of each boundary object in level joined list (SliceZ = Front/Back, SliceY = Bottom/Top, SliceX = Left/Right)
     size_t* m_size_MG_bSliceZ_level;
@@ -97,6 +106,8 @@ private:
     //---- all level joined / arrays for GPU -----
     size_t* m_data_MG_iList_level_joined;
     size_t* m_data_MG_bList_level_joined;
+    size_t* m_data_MG_iRuns_start_level_joined;   // first index of run
+    size_t* m_data_MG_iRuns_length_level_joined;  // number of cells in run
     size_t* m_data_MG_sList_level_joined;
 
     size_t* m_data_MG_bFront_level_joined;
@@ -170,6 +181,7 @@ private:
     void calcSurfaces(Surface** surfaceList);
     void sendListsToGPU();
     void sendBoundaryListsToGPU();
+    void calcInnerRuns();
     void sendSurfaceListsToGPU();
     void sendObstacleListsToGPU();
 
@@ -153,7 +153,13 @@ size_t Surface::get_k2() {
     return m_k1 + m_strideZ - 1;
 }
 
-void Surface::applyBoundaryConditions(real *dataField, FieldType fieldType, size_t level, bool sync) {
+template<typename T>
+void Surface::applyBoundaryConditions(T *dataField, FieldType fieldType, size_t level, bool sync) {
     // TODO(linh)
     // m_bdc_boundary->apply_boundary_condition(dataField, indexFields, patch_starts, patch_ends, fieldType, level, sync);
 }
+
+template void Surface::applyBoundaryConditions<real>(real *dataField, FieldType fieldType, size_t level, bool sync);
+#ifdef MIXED_PRECISION
+template void Surface::applyBoundaryConditions<real_lp>(real_lp *dataField, FieldType fieldType, size_t level, bool sync);
+#endif
@@ -30,7 +30,8 @@ class Surface {
 
     void setBoundaryConditions(tinyxml2::XMLElement *xmlElement);
 
-    void applyBoundaryConditions(real *dataField, FieldType FieldType, size_t level, bool sync);
+    template<typename T>
+    void applyBoundaryConditions(T *dataField, FieldType FieldType, size_t level, bool sync);
 
     void print();
 
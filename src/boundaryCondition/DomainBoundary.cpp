@@ -22,7 +22,8 @@ namespace {
     /// \param  value Value of boundary condition
     /// \param  sign Sign of boundary condition ( POSITIVE_SIGN or NEGATIVE_SIGN )
     // ***************************************************************************************
-    void apply_boundary_condition(real *data_field, const size_t *d_patch, size_t patch_start, size_t patch_end, size_t level, int8_t sign_reference_index, size_t reference_index, real value, int8_t sign) {
+    template<typename T>
+    void apply_boundary_condition(T *data_field, const size_t *d_patch, size_t patch_start, size_t patch_end, size_t level, int8_t sign_reference_index, size_t reference_index, real value, int8_t sign) {
         Domain *domain = Domain::getInstance();
         size_t b_size = domain->get_size(level);
 #pragma acc data present(data_field[:b_size])
@@ -47,7 +48,8 @@ namespace {
     /// \param  level Multigrid level
     /// \param  value Value of boundary condition
     // ***************************************************************************************
-    void apply_dirichlet(real *data_field, size_t *d_patch, Patch patch, size_t patch_start, size_t patch_end, size_t level, real value) {
+    template<typename T>
+    void apply_dirichlet(T *data_field, size_t *d_patch, Patch patch, size_t patch_start, size_t patch_end, size_t level, real value) {
         if (level > 0) {
             value = 0;
         }
@@ -96,7 +98,8 @@ namespace {
     /// \param  level Multigrid level
     /// \param  value Value of boundary condition
     // ***************************************************************************************
-    void apply_neumann(real *data_field, size_t *d_patch, Patch patch, size_t patch_start, size_t patch_end, size_t level, real value) {
+    template<typename T>
+    void apply_neumann(T *data_field, size_t *d_patch, Patch patch, size_t patch_start, size_t patch_end, size_t level, real value) {
         if (level > 0) {
             value = 0;
         }
@@ -145,7 +148,8 @@ namespace {
     /// \param  patch_end End index of patch
     /// \param  level Multigrid level
     // ***************************************************************************************
-    void apply_periodic(real *data_field, size_t *d_patch, Patch patch, size_t patch_start, size_t patch_end, size_t level) {
+    template<typename T>
+    void apply_periodic(T *data_field, size_t *d_patch, Patch patch, size_t patch_start, size_t patch_end, size_t level) {
         Domain *domain = Domain::getInstance();
         size_t Nx = domain->get_Nx(level);
         size_t Ny = domain->get_Ny(level);
@@ -194,8 +198,10 @@ namespace {
 /// \param  level Multigrid level
 /// \param  boundary_data Boundary data_field object of Domain
 /// \param  sync synchronous kernel launching (true, default: false)
+/// \param  homogeneous zero-value boundary conditions also in level 0 (default: false)
 // ***************************************************************************************
-void apply_boundary_condition(real *data_field, size_t **index_fields, const size_t *patch_starts, const size_t *patch_ends, size_t level, BoundaryData *boundary_data, bool sync) {
+template<typename T>
+void apply_boundary_condition(T *data_field, size_t **index_fields, const size_t *patch_starts, const size_t *patch_ends, size_t level, BoundaryData *boundary_data, bool sync, bool homogeneous) {
     for (size_t i = 0; i < numberOfPatches; i++) {
         size_t *d_patch = *(index_fields + i);
         size_t patch_start = *(patch_starts + i);
@@ -204,10 +210,10 @@ void apply_boundary_condition(real *data_field, size_t **index_fields, const siz
         BoundaryCondition bc = boundary_data->getBoundaryCondition(p);
         switch (bc) {
             case BoundaryCondition::DIRICHLET:
-                apply_dirichlet(data_field, d_patch, p, patch_start, patch_end, level, boundary_data->getValue(p));
+                apply_dirichlet(data_field, d_patch, p, patch_start, patch_end, level, homogeneous ? 0 : boundary_data->getValue(p));
                 break;
             case BoundaryCondition::NEUMANN:
-                apply_neumann(data_field, d_patch, p, patch_start, patch_end, level, boundary_data->getValue(p));
+                apply_neumann(data_field, d_patch, p, patch_start, patch_end, level, homogeneous ? 0 : boundary_data->getValue(p));
                 break;
             case BoundaryCondition::PERIODIC:
                 apply_periodic(data_field, d_patch, p, patch_start, patch_end, level);
@@ -224,4 +230,54 @@ void apply_boundary_condition(real *data_field, size_t **index_fields, const siz
 #pragma acc wait
     }
 }
+
+//======================================== Get ghost rule ====================================
+// ***************************************************************************************
+/// \brief  Rule applied to ghost cells of a domain patch, ghost cell \a idx is set to
+///         \a sign * data_field[idx + offset] + \a value (as in apply_boundary_condition)
+/// \param  patch Patch
+/// \param  level Multigrid level
+/// \param  boundary_data Boundary data_field object of Domain
+/// \param  offset (out) index offset of reference cell
+/// \param  sign (out) sign of reference value
+/// \param  value (out) value added
+/// \return false if boundary condition of patch is unknown
+// ***************************************************************************************
+bool get_ghost_rule(Patch patch, size_t level, BoundaryData *boundary_data, long int &offset, real &sign, real &value) {
+    Domain *domain = Domain::getInstance();
+    const long int Nx = static_cast<long int> (domain->get_Nx(level));
+    const long int Ny = static_cast<long int> (domain->get_Ny(level));
+    const long int sign_reference_index = (patch == BACK || patch == TOP || patch == RIGHT) ? NEGATIVE_SIGN : POSITIVE_SIGN;
+
+    BoundaryCondition bc = boundary_data->getBoundaryCondition(patch);
+    value = level > 0 ? 0 : boundary_data->getValue(patch);
+    switch (bc) {
+        case BoundaryCondition::DIRICHLET:
+            offset = (patch == FRONT || patch == BACK) ? Nx * Ny : (patch == BOTTOM || patch == TOP) ? Nx : 1;
+            sign = NEGATIVE_SIGN;
+            value *= 2;
+            break;
+        case BoundaryCondition::NEUMANN:
+            offset = (patch == FRONT || patch == BACK) ? Nx * Ny : (patch == BOTTOM || patch == TOP) ? Nx : 1;
+            sign = POSITIVE_SIGN;
+            value *= (patch == BOTTOM || patch == TOP) ? domain->get_dy(level) : domain->get_dz(level);  // as in apply_neumann
+            break;
+        case BoundaryCondition::PERIODIC:
+            offset = (patch == FRONT || patch == BACK) ? Nx * Ny * static_cast<long int> (domain->get_nz(level) - 2) :
+                     (patch == BOTTOM || patch == TOP) ? Nx * static_cast<long int> (domain->get_ny(level) - 2) :
+                     static_cast<long int> (domain->get_nx(level) - 2);
+            sign = POSITIVE_SIGN;
+            value = 0;
+            break;
+        default:
+            return false;
+    }
+    offset *= sign_reference_index;
+    return true;
+}
+
+template void apply_boundary_condition<real>(real *data_field, size_t **index_fields, const size_t *patch_starts, const size_t *patch_ends, size_t level, BoundaryData *boundary_data, bool sync, bool homogeneous);
+#ifdef MIXED_PRECISION
+template void apply_boundary_condition<real_lp>(real_lp *data_field, size_t **index_fields, const size_t *patch_starts, const size_t *patch_ends, size_t level, BoundaryData *boundary_data, bool sync, bool homogeneous);
+#endif
 }  // namespace DomainBoundary
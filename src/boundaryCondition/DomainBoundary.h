@@ -12,6 +12,8 @@
 #include "../utility/Utility.h"
 
 namespace DomainBoundary {
-    void apply_boundary_condition(real* data_field, size_t** index_fields, const size_t* patch_starts, const size_t* patch_ends, size_t level, BoundaryData* boundary_data, bool sync = true);
+    template<typename T>
+    void apply_boundary_condition(T* data_field, size_t** index_fields, const size_t* patch_starts, const size_t* patch_ends, size_t level, BoundaryData* boundary_data, bool sync = true, bool homogeneous = false);
+    bool get_ghost_rule(Patch patch, size_t level, BoundaryData* boundary_data, long int &offset, real &sign, real &value);
 }  // namespace DomainBoundary
 #endif /* ARTSS_BOUNDARYCONDITION_DOMAINBOUNDARY_H */
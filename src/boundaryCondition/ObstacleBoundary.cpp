@@ -24,7 +24,8 @@ namespace {
     /// \param  value Value of boundary condition
     /// \param  sign Sign of boundary condition (POSITIVE_SIGN or NEGATIVE_SIGN)
     // ***************************************************************************************
-    void apply_boundary_condition(real *data_field, const size_t *d_patch, size_t patch_start, size_t patch_end, size_t level, int8_t sign_reference_index, size_t reference_index, real value, int8_t sign) {
+    template<typename T>
+    void apply_boundary_condition(T *data_field, const size_t *d_patch, size_t patch_start, size_t patch_end, size_t level, int8_t sign_reference_index, size_t reference_index, real value, int8_t sign) {
         Domain *domain = Domain::getInstance();
         size_t b_size = domain->get_size(level);
 #pragma acc data present(data_field[:b_size])
@@ -49,7 +50,8 @@ namespace {
     /// \param  level Multigrid level
     /// \param  value Value of boundary condition
     // ***************************************************************************************
-    void apply_dirichlet(real *data_field, size_t *d_patch, Patch p, size_t patch_start, size_t patch_end, size_t level, real value) {
+    template<typename T>
+    void apply_dirichlet(T *data_field, size_t *d_patch, Patch p, size_t patch_start, size_t patch_end, size_t level, real value) {
         if (level > 0) {
             value = 0;
         }
@@ -99,7 +101,8 @@ namespace {
     /// \param  level Multigrid level
     /// \param  value Value of boundary condition
     // ***************************************************************************************
-    void apply_neumann(real *data_field, size_t *d_patch, Patch p, size_t patch_start, size_t patch_end, size_t level, real value) {
+    template<typename T>
+    void apply_neumann(T *data_field, size_t *d_patch, Patch p, size_t patch_start, size_t patch_end, size_t level, real value) {
         if (level > 0) {
             value = 0;
         }
@@ -149,7 +152,8 @@ namespace {
     /// \param  patch_end End index of patch
     /// \param  level Multigrid level
     // ***************************************************************************************
-    void apply_periodic(real *data_field, size_t *d_patch, Patch p, size_t patch_start, size_t patch_end, size_t level, size_t id) {
+    template<typename T>
+    void apply_periodic(T *data_field, size_t *d_patch, Patch p, size_t patch_start, size_t patch_end, size_t level, size_t id) {
         Domain *domain = Domain::getInstance();
         size_t Nx = domain->get_Nx(level);
         size_t Ny = domain->get_Ny(level);
@@ -196,8 +200,10 @@ namespace {
 /// \param  boundary_data Boundary data object of Domain
 /// \param  id ID of obstacle
 /// \param  sync synchronous kernel launching (true, default: false)
+/// \param  homogeneous zero-value boundary conditions also in level 0 (default: false)
 // ***************************************************************************************
-void apply_boundary_condition(real *data, size_t **index_fields, const size_t *patch_starts, const size_t *patch_ends, size_t level, BoundaryData *boundary_data, size_t id, bool sync) {
+template<typename T>
+void apply_boundary_condition(T *data, size_t **index_fields, const size_t *patch_starts, const size_t *patch_ends, size_t level, BoundaryData *boundary_data, size_t id, bool sync, bool homogeneous) {
     for (size_t i = 0; i < numberOfPatches; i++) {
         size_t *d_patch = *(index_fields + i);
         size_t patch_start = *(patch_starts + i);
@@ -206,10 +212,10 @@ void apply_boundary_condition(real *data, size_t **index_fields, const size_t *p
         BoundaryCondition bc = boundary_data->getBoundaryCondition(p);
         switch (bc) {
             case BoundaryCondition::DIRICHLET:
-                apply_dirichlet(data, d_patch, p, patch_start, patch_end, level, boundary_data->getValue(p));
+                apply_dirichlet(data, d_patch, p, patch_start, patch_end, level, homogeneous ? 0 : boundary_data->getValue(p));
                 break;
             case BoundaryCondition::NEUMANN:
-                apply_neumann(data, d_patch, p, patch_start, patch_end, level, boundary_data->getValue(p));
+                apply_neumann(data, d_patch, p, patch_start, patch_end, level, homogeneous ? 0 : boundary_data->getValue(p));
                 break;
             case BoundaryCondition::PERIODIC:
                 apply_periodic(data, d_patch, p, patch_start, patch_end, level, id);
@@ -227,4 +233,8 @@ void apply_boundary_condition(real *data, size_t **index_fields, const size_t *p
     }
 }
 
+template void apply_boundary_condition<real>(real *data, size_t **index_fields, const size_t *patch_starts, const size_t *patch_ends, size_t level, BoundaryData *boundary_data, size_t id, bool sync, bool homogeneous);
+#ifdef MIXED_PRECISION
+template void apply_boundary_condition<real_lp>(real_lp *data, size_t **index_fields, const size_t *patch_starts, const size_t *patch_ends, size_t level, BoundaryData *boundary_data, size_t id, bool sync, bool homogeneous);
+#endif
 }  // namespace ObstacleBoundary
@@ -12,7 +12,8 @@
 #include "../boundary/BoundaryData.h"
 
 namespace ObstacleBoundary {
-    void apply_boundary_condition(real* data, size_t** index_fields, const size_t* patch_starts, const size_t* patch_ends, size_t level, BoundaryData* boundary_data, size_t id, bool sync = true);
+    template<typename T>
+    void apply_boundary_condition(T* data, size_t** index_fields, const size_t* patch_starts, const size_t* patch_ends, size_t level, BoundaryData* boundary_data, size_t id, bool sync = true, bool homogeneous = false);
 }  // namespace ObstacleBoundary
 
 #endif /* ARTSS_BOUNDARYCONDITION_OBSTACLEBOUNDARY_H */
@@ -0,0 +1,401 @@
+/// \file       CGDiffuse.cpp
+/// \brief      Solves diffusion equation with preconditioned conjugate gradient method
+/// \date       Oct 17, 2026
+/// \author     ARTSS developers
+/// \copyright  <2015-2020> Forschungszentrum Juelich GmbH. All rights reserved.
+
+#include <cmath>
+#include <string>
+
+#include "CGDiffuse.h"
+#include "../utility/Parameters.h"
+#include "../boundary/BoundaryController.h"
+#include "../Domain.h"
+
+// =============================== Constructor ===============================
+CGDiffuse::CGDiffuse() {
+#ifndef BENCHMARKING
+    m_logger = Utility::create_logger(typeid(this).name());
+#endif
+    auto params = Parameters::getInstance();
+    auto domain = Domain::getInstance();
+
+    m_dt = params->get_real("physical_parameters/dt");
+    m_max_iter = static_cast<size_t>(params->get_int("solver/diffusion/max_iter"));
+    m_tol_res = params->get_real("solver/diffusion/tol_res");
+    m_w = params->get_real("solver/diffusion/w");
+
+    // diagonal (Jacobi, default) or n_relax weighted Jacobi sweeps (Smoother) as preconditioner
+    m_smoother = (params->get("solver/diffusion/preconditioner/type", "Jacobi") == "Smoother");
+    m_n_relax = std::stoi(params->get("solver/diffusion/preconditioner/n_relax", "2"));
+
+    m_residuum = new Field(FieldType::UNKNOWN_FIELD, 0.0);
+    m_precond_residuum = new Field(FieldType::UNKNOWN_FIELD, 0.0);
+    m_smooth = new Field(FieldType::UNKNOWN_FIELD, 0.0);
+    m_direction = new Field(FieldType::UNKNOWN_FIELD, 0.0);
+    m_operator_direction = new Field(FieldType::UNKNOWN_FIELD, 0.0);
+    m_operator_boundary = new Field(FieldType::UNKNOWN_FIELD, 0.0);
+    m_rcoeff = new Field(FieldType::UNKNOWN_FIELD, 0.0);
+
+    auto d_r = m_residuum->data;
+    auto d_z = m_precond_residuum->data;
+    auto d_t = m_smooth->data;
+    auto d_d = m_direction->data;
+    auto d_q = m_operator_direction->data;
+    auto d_g = m_operator_boundary->data;
+    auto d_rc = m_rcoeff->data;
+    size_t bsize = domain->get_size();
+
+#pragma acc enter data copyin(d_r[:bsize], d_z[:bsize], d_t[:bsize], d_d[:bsize], d_q[:bsize], d_g[:bsize], d_rc[:bsize])
+}
+
+CGDiffuse::~CGDiffuse() {
+    auto domain = Domain::getInstance();
+    size_t bsize = domain->get_size();
+
+    auto d_r = m_residuum->data;
+    auto d_z = m_precond_residuum->data;
+    auto d_t = m_smooth->data;
+    auto d_d = m_direction->data;
+    auto d_q = m_operator_direction->data;
+    auto d_g = m_operator_boundary->data;
+    auto d_rc = m_rcoeff->data;
+
+#pragma acc exit data delete(d_r[:bsize], d_z[:bsize], d_t[:bsize], d_d[:bsize], d_q[:bsize], d_g[:bsize], d_rc[:bsize])
+
+    delete m_residuum;
+    delete m_precond_residuum;
+    delete m_smooth;
+    delete m_direction;
+    delete m_operator_direction;
+    delete m_operator_boundary;
+    delete m_rcoeff;
+}
+
+// ============================ Diffuse =====================================
+// *****************************************************************************
+/// \brief  solves diffusion equation \f$ \partial_t \phi_2 = \nu \ nabla^2 \phi_2 \f$
+///     via preconditioned conjugate gradient method (dependent on residual/ maximal iterations)
+/// \param  out     output pointer (initial guess)
+/// \param  in      input pointer (not used)
+/// \param  b       source pointer
+/// \param  D       diffusion coefficient (nu - velocity, kappa - temperature)
+/// \param  sync    synchronization boolean (true=sync (default), false=async)
+// ***************************************************************************************
+void CGDiffuse::diffuse(Field *out, Field *in, const Field *b, const real D, bool sync) {
+    auto boundary = BoundaryController::getInstance();
+    size_t bsize = Domain::getInstance()->get_size();
+
+    auto d_rc = m_rcoeff->data;
+    size_t *d_iList = boundary->get_innerList_level_joined();
+    auto bsize_i = boundary->getSize_innerList();
+
+    const real rc = 1. / (D * m_dt);
+
+#pragma omp parallel for
+#pragma acc parallel loop independent present(d_rc[:bsize], d_iList[:bsize_i]) async
+    for (size_t j = 0; j < bsize_i; ++j) {
+        d_rc[d_iList[j]] = rc;
+    }
+
+    solve(out, b, sync);
+}
+
+// ======================= Turbulent version ================================
+// ************************************************************************
+/// \brief  solves turbulent diffusion equation \f$ \partial_t \phi_2 = \nu \ nabla^2 \phi_2 \f$
+///     via preconditioned conjugate gradient method (dependent on residual/ maximal iterations)
+/// \param  out     output pointer (initial guess)
+/// \param  in      input pointer (not used)
+/// \param  b       source pointer
+/// \param  D       diffusion coefficient (nu - velocity, kappa - temperature)
+/// \param  EV      turbulent diffusion coefficient (eddy viscosity)
+/// \param  sync    synchronization boolean (true=sync (default), false=async)
+// ***************************************************************************************
+void CGDiffuse::diffuse(Field *out, Field *in, const Field *b, const real D, const Field *EV, bool sync) {
+    auto boundary = BoundaryController::getInstance();
+    size_t bsize = Domain::getInstance()->get_size();
+
+    auto d_rc = m_rcoeff->data;
+    auto d_EV = EV->data;
+    size_t *d_iList = boundary->get_innerList_level_joined();
+    auto bsize_i = boundary->getSize_innerList();
+
+    const real dt = m_dt;
+
+#pragma omp parallel for
+#pragma acc parallel loop independent present(d_rc[:bsize], d_EV[:bsize], d_iList[:bsize_i]) async
+    for (size_t j = 0; j < bsize_i; ++j) {
+        const size_t i = d_iList[j];
+        d_rc[i] = 1. / ((D + d_EV[i]) * dt);
+    }
+
+    solve(out, b, sync);
+}
+
+//==================================== Operator ================================
+// *****************************************************************************
+/// \brief  applies the linear part of the symmetrized operator
+///         \f$ q = (C^{-1} - \nabla^2) d\f$ (boundary conditions of d are set, their
+///         inhomogeneous part is subtracted)
+/// \param  out         q
+/// \param  in          direction d (boundary cells overwritten)
+/// \param  type        type of boundary conditions
+/// \param  dot         scalar product of d and q in inner cells
+/// \param  sync        synchronization boolean (true=sync (default), false=async)
+// *****************************************************************************
+void CGDiffuse::Operator(Field *out, Field *in, FieldType type, real &dot, bool sync) {
+    auto domain = Domain::getInstance();
+    auto boundary = BoundaryController::getInstance();
+
+    auto d_out = out->data;
+    auto d_in = in->data;
+    auto d_g = m_operator_boundary->data;
+    auto d_rc = m_rcoeff->data;
+
+    const size_t Nx = domain->get_Nx();
+    const size_t Ny = domain->get_Ny();
+    size_t bsize = domain->get_size();
+
+    const real rdx2 = 1. / (domain->get_dx() * domain->get_dx());
+    const real rdy2 = 1. / (domain->get_dy() * domain->get_dy());
+    const real rdz2 = 1. / (domain->get_dz() * domain->get_dz());
+    const real diag = 2. * (rdx2 + rdy2 + rdz2);
+
+    size_t *d_iList = boundary->get_innerList_level_joined();
+    auto bsize_i = boundary->getSize_innerList();
+
+    boundary->applyBoundary(d_in, type, sync);
+
+    real sum = 0.;
+#pragma omp parallel for reduction(+:sum)
+#pragma acc parallel loop independent present(d_out[:bsize], d_in[:bsize], d_g[:bsize], d_rc[:bsize], d_iList[:bsize_i]) reduction(+:sum) async
+    for (size_t j = 0; j < bsize_i; ++j) {
+        const size_t i = d_iList[j];
+        const real q_i = (d_rc[i] + diag) * d_in[i]\
+ - rdx2 * (d_in[i - 1] + d_in[i + 1])\
+ - rdy2 * (d_in[i - Nx] + d_in[i + Nx])\
+ - rdz2 * (d_in[i - Nx * Ny] + d_in[i + Nx * Ny]) - d_g[i];
+        d_out[i] = q_i;
+        sum += d_in[i] * q_i;
+    }
+#pragma acc wait
+    dot = sum;
+}
+
+//================================== Precondition ==============================
+// *****************************************************************************
+/// \brief  approximately solves \f$ (C^{-1} - \nabla^2) z = r\f$ by the diagonal or by
+///         n_relax weighted Jacobi sweeps starting from zero. Cells outside of the inner
+///         list are kept zero (homogeneous Dirichlet), thus the preconditioner is symmetric
+/// \param  out         preconditioned residuum z (m_precond_residuum)
+/// \param  in          residuum r
+/// \param  sync        synchronization boolean (true=sync (default), false=async)
+// *****************************************************************************
+void CGDiffuse::Precondition(Field *out, const Field *in, bool sync) {
+    auto domain = Domain::getInstance();
+    auto boundary = BoundaryController::getInstance();
+
+    auto d_out = out->data;
+    auto d_in = in->data;
+    auto d_tmp = m_smooth->data;
+    auto d_rc = m_rcoeff->data;
+
+    const size_t Nx = domain->get_Nx();
+    const size_t Ny = domain->get_Ny();
+    size_t bsize = domain->get_size();
+
+    const real rdx2 = 1. / (domain->get_dx() * domain->get_dx());
+    const real rdy2 = 1. / (domain->get_dy() * domain->get_dy());
+    const real rdz2 = 1. / (domain->get_dz() * domain->get_dz());
+    const real diag = 2. * (rdx2 + rdy2 + rdz2);
+    const real w = m_smoother ? m_w : 1.;
+
+    size_t *d_iList = boundary->get_innerList_level_joined();
+    auto bsize_i = boundary->getSize_innerList();
+
+    // first sweep from zero (diagonal scaling)
+#pragma omp parallel for
+#pragma acc parallel loop independent present(d_out[:bsize], d_in[:bsize], d_rc[:bsize], d_iList[:bsize_i]) async
+    for (size_t j = 0; j < bsize_i; ++j) {
+        const size_t i = d_iList[j];
+        d_out[i] = w * d_in[i] / (d_rc[i] + diag);
+    }
+
+    if (m_smoother) {
+        for (int s = 1; s < m_n_relax; s++) {
+#pragma omp parallel for
+#pragma acc parallel loop independent present(d_out[:bsize], d_tmp[:bsize], d_in[:bsize], d_rc[:bsize], d_iList[:bsize_i]) async
+            for (size_t j = 0; j < bsize_i; ++j) {
+                const size_t i = d_iList[j];
+                const real diag_i = d_rc[i] + diag;
+                const real res_i = d_in[i] - (diag_i * d_out[i]\
+ - rdx2 * (d_out[i - 1] + d_out[i + 1])\
+ - rdy2 * (d_out[i - Nx] + d_out[i + Nx])\
+ - rdz2 * (d_out[i - Nx * Ny] + d_out[i + Nx * Ny]));
+                d_tmp[i] = d_out[i] + w * res_i / diag_i;
+            }
+            Field::swap(out, m_smooth);
+            d_out = out->data;
+            d_tmp = m_smooth->data;
+        }
+    }
+
+    if (sync) {
+#pragma acc wait
+    }
+}
+
+//===================================== Solve ==================================
+// *****************************************************************************
+/// \brief  solves \f$ (C^{-1} - \nabla^2) x = C^{-1} b\f$ via preconditioned conjugate
+///         gradient method, stops if \f$ ||b - A x|| < tol\_res\f$ (residuum of the
+///         unscaled system as in JacobiDiffuse), 1/C has to be set in m_rcoeff
+/// \param  out         output pointer (initial guess)
+/// \param  b           source pointer
+/// \param  sync        synchronization boolean (true=sync (default), false=async)
+// *****************************************************************************
+void CGDiffuse::solve(Field *out, const Field *b, bool sync) {
+    auto domain = Domain::getInstance();
+    auto boundary = BoundaryController::getInstance();
+
+    auto d_out = out->data;
+    auto d_b = b->data;
+    auto d_r = m_residuum->data;
+    auto d_d = m_direction->data;
+    auto d_q = m_operator_direction->data;
+    auto d_g = m_operator_boundary->data;
+    auto d_rc = m_rcoeff->data;
+
+    const size_t Nx = domain->get_Nx();
+    const size_t Ny = domain->get_Ny();
+    size_t bsize = domain->get_size();
+
+    const real rdx2 = 1. / (domain->get_dx() * domain->get_dx());
+    const real rdy2 = 1. / (domain->get_dy() * domain->get_dy());
+    const real rdz2 = 1. / (domain->get_dz() * domain->get_dz());
+    const real diag = 2. * (rdx2 + rdy2 + rdz2);
+
+    size_t *d_iList = boundary->get_innerList_level_joined();
+    auto bsize_i = boundary->getSize_innerList();
+
+    FieldType type = out->get_type();
+
+#pragma acc data present(d_out[:bsize], d_b[:bsize], d_r[:bsize], d_d[:bsize], d_q[:bsize], d_g[:bsize], d_rc[:bsize], d_iList[:bsize_i])
+    {
+        // contribution of the (inhomogeneous) boundary conditions of this field type,
+        // i.e. operator applied to zero with boundary conditions
+#pragma omp parallel for
+#pragma acc parallel loop independent present(d_d[:bsize], d_iList[:bsize_i]) async
+        for (size_t j = 0; j < bsize_i; ++j) {
+            d_d[d_iList[j]] = 0.;
+        }
+        boundary->applyBoundary(d_d, type, sync);
+
+#pragma omp parallel for
+#pragma acc parallel loop independent present(d_d[:bsize], d_g[:bsize], d_iList[:bsize_i]) async
+        for (size_t j = 0; j < bsize_i; ++j) {
+            const size_t i = d_iList[j];
+            d_g[i] = - rdx2 * (d_d[i - 1] + d_d[i + 1])\
+ - rdy2 * (d_d[i - Nx] + d_d[i + Nx])\
+ - rdz2 * (d_d[i - Nx * Ny] + d_d[i + Nx * Ny]);
+        }
+
+        boundary->applyBoundary(d_out, type, sync);
+
+        // r = C^-1 b - A x (scaled residuum), ||b - A x|| = ||C r||
+        real sum = 0.;
+#pragma omp parallel for reduction(+:sum)
+#pragma acc parallel loop independent present(d_out[:bsize], d_b[:bsize], d_r[:bsize], d_rc[:bsize], d_iList[:bsize_i]) reduction(+:sum) async
+        for (size_t j = 0; j < bsize_i; ++j) {
+            const size_t i = d_iList[j];
+            const real r_i = d_rc[i] * d_b[i] - ((d_rc[i] + diag) * d_out[i]\
+ - rdx2 * (d_out[i - 1] + d_out[i + 1])\
+ - rdy2 * (d_out[i - Nx] + d_out[i + Nx])\
+ - rdz2 * (d_out[i - Nx * Ny] + d_out[i + Nx * Ny]));
+            d_r[i] = r_i;
+            sum += (r_i / d_rc[i]) * (r_i / d_rc[i]);
+        }
+#pragma acc wait
+        real res = sqrt(sum);
+
+        size_t it = 0;
+        if (res > m_tol_res) {
+            // z = M^-1 r, d = z
+            Precondition(m_precond_residuum, m_residuum, sync);
+            auto d_z = m_precond_residuum->data;
+
+            real rz = 0.;
+#pragma omp parallel for reduction(+:rz)
+#pragma acc parallel loop independent present(d_r[:bsize], d_z[:bsize], d_d[:bsize], d_iList[:bsize_i]) reduction(+:rz) async
+            for (size_t j = 0; j < bsize_i; ++j) {
+                const size_t i = d_iList[j];
+                d_d[i] = d_z[i];
+                rz += d_r[i] * d_z[i];
+            }
+#pragma acc wait
+
+            while (res > m_tol_res && it < m_max_iter) {
+                // q = A d, alpha = (r, z)/(d, q)
+                real dq = 0.;
+                Operator(m_operator_direction, m_direction, type, dq, sync);
+                const real alpha = rz / dq;
+
+                // x = x + alpha d, r = r - alpha q (residuum and (r, z_old) in the same sweep)
+                real rr = 0.;
+                real rz_old = 0.;
+#pragma omp parallel for reduction(+:rr, rz_old)
+#pragma acc parallel loop independent present(d_out[:bsize], d_r[:bsize], d_z[:bsize], d_d[:bsize], d_q[:bsize], d_rc[:bsize], d_iList[:bsize_i]) reduction(+:rr, rz_old) async
+                for (size_t j = 0; j < bsize_i; ++j) {
+                    const size_t i = d_iList[j];
+                    d_out[i] += alpha * d_d[i];
+                    const real r_i = d_r[i] - alpha * d_q[i];
+                    d_r[i] = r_i;
+                    rr += (r_i / d_rc[i]) * (r_i / d_rc[i]);
+                    rz_old += r_i * d_z[i];
+                }
+#pragma acc wait
+                res = sqrt(rr);
+                it++;
+
+                if (res <= m_tol_res) {
+                    break;
+                }
+
+                Precondition(m_precond_residuum, m_residuum, sync);
+                d_z = m_precond_residuum->data;
+
+                real rz_new = 0.;
+#pragma omp parallel for reduction(+:rz_new)
+#pragma acc parallel loop independent present(d_r[:bsize], d_z[:bsize], d_iList[:bsize_i]) reduction(+:rz_new) async
+                for (size_t j = 0; j < bsize_i; ++j) {
+                    const size_t i = d_iList[j];
+                    rz_new += d_r[i] * d_z[i];
+                }
+#pragma acc wait
+
+                // Polak-Ribiere update (equals Fletcher-Reeves for a fixed preconditioner)
+                const real beta = (rz_new - rz_old) / rz;
+                rz = rz_new;
+
+#pragma omp parallel for
+#pragma acc parallel loop independent present(d_z[:bsize], d_d[:bsize], d_iList[:bsize_i]) async
+                for (size_t j = 0; j < bsize_i; ++j) {
+                    const size_t i = d_iList[j];
+                    d_d[i] = d_z[i] + beta * d_d[i];
+                }
+            }
+        }
+
+        boundary->applyBoundary(d_out, type, sync);
+
+        if (sync) {
+#pragma acc wait
+        }
+
+#ifndef BENCHMARKING
+        m_logger->info("Number of iterations: {}", it);
+        m_logger->info("CG ||res|| = {:0.5e}", res);
+#endif
+    }  // end data region
+}
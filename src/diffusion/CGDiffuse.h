@@ -0,0 +1,51 @@
+/// \file       CGDiffuse.h
+/// \brief      Solves diffusion equation with preconditioned conjugate gradient method
+/// \date       Oct 17, 2026
+/// \author     ARTSS developers
+/// \copyright  <2015-2020> Forschungszentrum Juelich GmbH. All rights reserved.
+
+#ifndef ARTSS_DIFFUSION_CGDIFFUSE_H_
+#define ARTSS_DIFFUSION_CGDIFFUSE_H_
+
+#include "../interfaces/IDiffusion.h"
+#include "../field/Field.h"
+#include "../utility/GlobalMacrosTypes.h"
+#include "../utility/Utility.h"
+
+/// \brief  implicit diffusion solver, conjugate gradient method applied to the symmetrized
+///         system \f$ (C^{-1} - \nabla^2) x = C^{-1} b\f$ with \f$ C = (D + EV)\cdot dt\f$.
+///         Preconditioned by its diagonal (Jacobi) or by n_relax weighted Jacobi sweeps
+///         (Smoother). Operator applied matrix-free on the inner list of BoundaryController.
+class CGDiffuse : public IDiffusion {
+public:
+    CGDiffuse();
+    ~CGDiffuse();
+
+    void diffuse(Field *out, Field *in, const Field *b, real D, bool sync) override;
+    void diffuse(Field *out, Field *in, const Field *b, real D, const Field *EV, bool sync) override;  // turbulent version
+
+private:
+    void solve(Field *out, const Field *b, bool sync);
+    void Operator(Field *out, Field *in, FieldType type, real &dot, bool sync = true);
+    void Precondition(Field *out, const Field *in, bool sync = true);
+
+    real m_dt;
+    size_t m_max_iter;
+    real m_tol_res;
+    bool m_smoother;
+    int m_n_relax;
+    real m_w;
+
+    Field *m_residuum;
+    Field *m_precond_residuum;
+    Field *m_smooth;
+    Field *m_direction;
+    Field *m_operator_direction;
+    Field *m_operator_boundary;
+    Field *m_rcoeff;  // 1/C in inner cells
+#ifndef BENCHMARKING
+    std::shared_ptr<spdlog::logger> m_logger;
+#endif
+};
+
+#endif /* ARTSS_DIFFUSION_CGDIFFUSE_H_ */
@@ -34,6 +34,8 @@ ColoredGaussSeidelDiffuse::ColoredGaussSeidelDiffuse() {
         m_max_iter = 10000;
         m_tol_res = 1e-16;
     }
+    // two color sweeps over rows instead of eight strided sub-color sweeps
+    m_row_split = (params->get("solver/diffusion/row_split/enabled", "No") == "Yes");
 }
 
 // ========================== Diffuse =================================
@@ -95,7 +97,11 @@ void ColoredGaussSeidelDiffuse::diffuse(Field *out, Field *in, const Field *b, c
     real res = 1.;
 
     while (res > tol_res && it < max_it) {
-        colored_gauss_seidel_step(out, b, alpha_x, alpha_y, alpha_z, beta, dsign, w, sync);
+        if (m_row_split) {
+            red_black_step(out, b, alpha_x, alpha_y, alpha_z, beta, dsign, w, sync);
+        } else {
+            colored_gauss_seidel_step(out, b, alpha_x, alpha_y, alpha_z, beta, dsign, w, sync);
+        }
         boundary->applyBoundary(d_out, type, sync);
 
         sum = 0;
@@ -184,7 +190,11 @@ void ColoredGaussSeidelDiffuse::diffuse(Field *out, Field *in, const Field *b, c
     real res = 1.;
 
     while (res > tol_res && it < max_it) {
-        colored_gauss_seidel_step(out, b, dsign, w, D, EV, dt, sync);
+        if (m_row_split) {
+            red_black_step(out, b, dsign, w, D, EV, dt, sync);
+        } else {
+            colored_gauss_seidel_step(out, b, dsign, w, D, EV, dt, sync);
+        }
         boundary->applyBoundary(d_out, type, sync);
 
         sum = 0;
@@ -236,7 +246,8 @@ void ColoredGaussSeidelDiffuse::diffuse(Field *out, Field *in, const Field *b, c
 /// \param  w        weight (1. - diffusion, 2./3. - multigrid)
 /// \param  sync     synchronization boolean (true=sync (default), false=async)
 // ***************************************************************************************
-void ColoredGaussSeidelDiffuse::colored_gauss_seidel_step(Field *out, const Field *b, const real alpha_x, const real alpha_y, const real alpha_z, const real beta, const real dsign, const real w, bool sync) {
+template<typename T>
+void ColoredGaussSeidelDiffuse::colored_gauss_seidel_step(FieldT<T> *out, const FieldT<T> *b, const real alpha_x, const real alpha_y, const real alpha_z, const real beta, const real dsign, const real w, bool sync) {
 
     auto domain = Domain::getInstance();
     // local parameters for GPU
@@ -492,6 +503,133 @@ void ColoredGaussSeidelDiffuse::colored_gauss_seidel_step(Field *out, const Fiel
 //#pragma acc wait
 }
 
+//====================== Red-black iteration step ============================
+// *****************************************************************************
+/// \brief  applies single CGS step as two color sweeps over rows: red cells
+///         (i+j+k odd) of all rows first, then black cells (i+j+k even). Each row
+///         is streamed once per color instead of once per sub-color (4 loop nests
+///         per color in colored_gauss_seidel_step). Cells of one color are
+///         independent, hence the result equals colored_gauss_seidel_step.
+///         Like colored_gauss_seidel_step, obstacle cells are not excluded: they are
+///         smoothed as inner cells and only reset by the boundary conditions applied
+///         after the step, hence use it in domains without obstacles
+/// \param  out      output pointer
+/// \param  b        source pointer
+/// \param  alpha_x  \f$ rdx^2\f$ for pressure, \f$ D\cdot dt\cdot rdx^2\f$ else
+/// \param  alpha_y  \f$ rdy^2\f$ for pressure, \f$ D\cdot dt\cdot rdy^2\f$ else
+/// \param  alpha_z  \f$ rdz^2\f$ for pressure, \f$ D\cdot dt\cdot rdz^2\f$ else
+/// \param  beta     \f$ 1./(2\cdot(\alpha_x + \alpha_y + \alpha_z))\f$ for pressure,
+///                  \f$ 1./(2\cdot(\alpha_x + \alpha_y + \alpha_z) + 1)\f$ else
+/// \param  dsign    sign (\a -1. for pressure, \a 1. else)
+/// \param  w        weight (1. - diffusion, 2./3. - multigrid)
+/// \param  sync     synchronization boolean (true=sync (default), false=async)
+// ***************************************************************************************
+template<typename T>
+void ColoredGaussSeidelDiffuse::red_black_step(FieldT<T> *out, const FieldT<T> *b, const real alpha_x, const real alpha_y, const real alpha_z, const real beta, const real dsign, const real w, bool sync) {
+    auto domain = Domain::getInstance();
+    // local parameters for GPU
+    const size_t level = out->get_level();
+    const size_t Nx = domain->get_Nx(level);
+    const size_t Ny = domain->get_Ny(level);
+    const size_t Nz = domain->get_Nz(level);
+    const size_t NxNy = Nx * Ny;
+
+    const size_t bsize = domain->get_size(level);
+
+    auto d_out = out->data;
+    auto d_b = b->data;
+
+    for (size_t color = 0; color < 2; color++) {
+#pragma omp parallel for collapse(2)
+#pragma acc parallel loop independent collapse(2) present(d_out[:bsize], d_b[:bsize]) async
+        for (size_t k = 1; k < Nz - 1; k++) {
+            for (size_t j = 1; j < Ny - 1; j++) {
+                T *row = d_out + IX(0, j, k, Nx, Ny);
+                const T *row_b = d_b + IX(0, j, k, Nx, Ny);
+                // first cell of the current color in this row
+                const size_t i_start = 1 + (j + k + color) % 2;
+#pragma acc loop seq
+                for (size_t i = i_start; i < Nx - 1; i += 2) {
+                    const real r_out = row[i];
+                    const real out_h = beta * (dsign * static_cast<real>(row_b[i])\
+                                  + alpha_x * (static_cast<real>(row[i + 1]) + static_cast<real>(row[i - 1]))\
+                                  + alpha_y * (static_cast<real>(row[i + Nx]) + static_cast<real>(row[i - Nx]))\
+                                  + alpha_z * (static_cast<real>(row[i + NxNy]) + static_cast<real>(row[i - NxNy])));
+                    row[i] = (1 - w) * r_out + w * out_h;
+                }
+            }
+        }
+#pragma acc wait
+    }
+
+    if (sync) {
+#pragma acc wait
+    }
+}
+
+// ============== Turbulent version of red-black iteration step =================
+// *****************************************************************************
+/// \brief  applies single CGS step as two color sweeps over rows (see red_black_step,
+///         obstacle cells are not excluded)
+/// \param  out      output pointer
+/// \param  b        source pointer
+/// \param  dsign    sign (\a -1. for pressure, \a 1. else)
+/// \param  w        weight (1. - diffusion, 2./3. - multigrid)
+/// \param  D        diffusion coefficient (nu - velocity, kappa - temperature)
+/// \param  EV       eddy viscosity (nu_turb)
+/// \param  dt       time step
+/// \param  sync     synchronization boolean (true=sync (default), false=async)
+// ***************************************************************************************
+void ColoredGaussSeidelDiffuse::red_black_step(Field *out, const Field *b, const real dsign, const real w, const real D, const Field *EV, const real dt, bool sync) {
+    auto domain = Domain::getInstance();
+    // local parameters for GPU
+    const size_t level = out->get_level();
+    const size_t Nx = domain->get_Nx(level);
+    const size_t Ny = domain->get_Ny(level);
+    const size_t Nz = domain->get_Nz(level);
+    const size_t NxNy = Nx * Ny;
+
+    const real rdx = 1. / domain->get_dx(level);
+    const real rdy = 1. / domain->get_dy(level);
+    const real rdz = 1. / domain->get_dz(level);
+
+    const size_t bsize = domain->get_size(level);
+
+    auto d_out = out->data;
+    auto d_b = b->data;
+    auto d_EV = EV->data;
+
+    for (size_t color = 0; color < 2; color++) {
+#pragma omp parallel for collapse(2)
+#pragma acc parallel loop independent collapse(2) present(d_out[:bsize], d_b[:bsize], d_EV[:bsize]) async
+        for (size_t k = 1; k < Nz - 1; k++) {
+            for (size_t j = 1; j < Ny - 1; j++) {
+                const size_t row = IX(0, j, k, Nx, Ny);
+                const size_t i_start = 1 + (j + k + color) % 2;
+#pragma acc loop seq
+                for (size_t i = row + i_start; i < row + Nx - 1; i += 2) {
+                    const real aX = (D + d_EV[i]) * dt * rdx * rdx;
+                    const real aY = (D + d_EV[i]) * dt * rdy * rdy;
+                    const real aZ = (D + d_EV[i]) * dt * rdz * rdz;
+                    const real bb = 1. / (1. + 2. * (aX + aY + aZ));
+
+                    const real r_out = d_out[i];
+                    const real out_h = bb * (dsign * d_b[i]\
+                                  + aX * (d_out[i + 1] + d_out[i - 1])\
+                                  + aY * (d_out[i + Nx] + d_out[i - Nx])\
+                                  + aZ * (d_out[i + NxNy] + d_out[i - NxNy]));
+                    d_out[i] = (1 - w) * r_out + w * out_h;
+                }
+            }
+        }
+#pragma acc wait
+    }
+
+    if (sync) {
+#pragma acc wait
+    }
+}
+
 // ========================= CGS stencil ==============================
 // ************************************************************************
 /// \brief  single CGS step
@@ -511,7 +649,8 @@ void ColoredGaussSeidelDiffuse::colored_gauss_seidel_step(Field *out, const Fiel
 /// \param  Nx       number of cells in x-direction of computational domain
 /// \param  Ny       number of cells in y-direction
 // ***************************************************************************************
-void ColoredGaussSeidelDiffuse::colored_gauss_seidel_stencil(size_t i, size_t j, size_t k, real *out, real *b, const real alpha_x, const real alpha_y, const real alpha_z, const real dsign, const real beta, const real w, const size_t Nx, const size_t Ny) {
+template<typename T>
+void ColoredGaussSeidelDiffuse::colored_gauss_seidel_stencil(size_t i, size_t j, size_t k, T *out, T *b, const real alpha_x, const real alpha_y, const real alpha_z, const real dsign, const real beta, const real w, const size_t Nx, const size_t Ny) {
 
     real d_out_x    = *(out + IX(i + 1, j, k, Nx, Ny)); // per value (not access) necessary due to performance issues
     real d_out_x2   = *(out + (IX(i - 1, j, k, Nx, Ny)));
@@ -529,3 +668,10 @@ void ColoredGaussSeidelDiffuse::colored_gauss_seidel_stencil(size_t i, size_t j,
 
     *(out + IX(i, j, k, Nx, Ny)) = (1 - w) * r_out + w * out_h;
 };
+
+template void ColoredGaussSeidelDiffuse::colored_gauss_seidel_step<real>(Field *out, const Field *b, real alpha_x, real alpha_y, real alpha_z, real beta, real dsign, real w, bool sync);
+template void ColoredGaussSeidelDiffuse::red_black_step<real>(Field *out, const Field *b, real alpha_x, real alpha_y, real alpha_z, real beta, real dsign, real w, bool sync);
+#ifdef MIXED_PRECISION
+template void ColoredGaussSeidelDiffuse::colored_gauss_seidel_step<real_lp>(FieldLP *out, const FieldLP *b, real alpha_x, real alpha_y, real alpha_z, real beta, real dsign, real w, bool sync);
+template void ColoredGaussSeidelDiffuse::red_black_step<real_lp>(FieldLP *out, const FieldLP *b, real alpha_x, real alpha_y, real alpha_z, real beta, real dsign, real w, bool sync);
+#endif
@@ -18,9 +18,14 @@ class ColoredGaussSeidelDiffuse: public IDiffusion {
 
     void diffuse(Field* out, Field* in, const Field* b, const real D, bool sync = true);
     void diffuse(Field* out, Field* in, const Field* b, const real D, const Field* EV, bool sync = true);  // turbulent version
-    static void colored_gauss_seidel_step(Field* out, const Field* b, const real alpha_x, const real alpha_y, const real alpha_z, const real beta, const real dsign, const real w, bool sync = true);
+    template<typename T>
+    static void colored_gauss_seidel_step(FieldT<T>* out, const FieldT<T>* b, const real alpha_x, const real alpha_y, const real alpha_z, const real beta, const real dsign, const real w, bool sync = true);
     static void colored_gauss_seidel_step(Field* out, const Field* b, const real dsign, const real w, const real D, const Field* EV, const real dt, bool sync = true); // turbulent version
-    static void colored_gauss_seidel_stencil(size_t i, size_t j, size_t k, real* out, real* b, const real alpha_x, const real alpha_y, const real alpha_z, const real dsign, const real beta, const real w, const size_t Nx, const size_t Ny);
+    template<typename T>
+    static void red_black_step(FieldT<T>* out, const FieldT<T>* b, const real alpha_x, const real alpha_y, const real alpha_z, const real beta, const real dsign, const real w, bool sync = true);
+    static void red_black_step(Field* out, const Field* b, const real dsign, const real w, const real D, const Field* EV, const real dt, bool sync = true); // turbulent version
+    template<typename T>
+    static void colored_gauss_seidel_stencil(size_t i, size_t j, size_t k, T* out, T* b, const real alpha_x, const real alpha_y, const real alpha_z, const real dsign, const real beta, const real w, const size_t Nx, const size_t Ny);
 
  private:
 #ifndef BENCHMARKING
@@ -31,6 +36,7 @@ class ColoredGaussSeidelDiffuse: public IDiffusion {
     real m_w;
     size_t m_max_iter;
     real m_tol_res;
+    bool m_row_split;
 };
 
 #endif /* ARTSS_DIFFUSION_COLOREDGAUSSSEIDEL_H */
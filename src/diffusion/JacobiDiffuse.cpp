@@ -6,6 +6,7 @@
 /// \copyright  <2015-2020> Forschungszentrum Juelich GmbH. All rights reserved.
 
 #include <cmath>
+#include <utility>
 
 #include "JacobiDiffuse.h"
 #include "../utility/Parameters.h"
@@ -32,7 +33,7 @@ JacobiDiffuse::JacobiDiffuse() {
 /// \brief  solves diffusion equation \f$ \partial_t \phi_2 = \nu \ nabla^2 \phi_2 \f$
 ///     via calculated iterations of Jacobi step (dependent on residual/ maximal iterations)
 /// \param  out     output pointer
-/// \param  in      input pointer
+/// \param  in      input pointer (initial guess, used as second buffer, overwritten)
 /// \param  b       source pointer
 /// \param  D     diffusion coefficient (nu - velocity, kappa - temperature)
 /// \param  sync    synchronization boolean (true=sync (default), false=async)
@@ -51,9 +52,11 @@ void JacobiDiffuse::diffuse(Field *out, Field *in, const Field *b, const real D,
 
     auto bsize_i = boundary->getSize_innerList();
     auto bsize_b = boundary->getSize_boundaryList();
+    auto bsize_o = boundary->getSize_obstacleList();
 
     size_t *d_iList = boundary->get_innerList_level_joined();
     size_t *d_bList = boundary->get_boundaryList_level_joined();
+    size_t *d_oList = boundary->get_obstacleList();
 
 #pragma acc data present(d_out[:bsize], d_in[:bsize], d_b[:bsize])
     {
@@ -81,52 +84,39 @@ void JacobiDiffuse::diffuse(Field *out, Field *in, const Field *b, const real D,
         real sum;
         real res = 1.;
 
+        // out and in are used as ping-pong buffers, odd iterations write into out, even ones into in
+        Field *dst = out;
+        Field *src = in;
         while (res > tol_res && it < max_it) {
-            JacobiStep(out, in, b, alphaX, alphaY, alphaZ, rbeta, dsign, w, sync);
-            boundary->applyBoundary(d_out, type, sync);
-
-            sum = 0.;
-
-#pragma acc parallel loop independent present(d_out[:bsize], d_in[:bsize], d_iList[:bsize_i]) async
-            for (size_t j = 0; j < bsize_i; ++j) {
-                const size_t i = d_iList[j];
-                res = rbeta * (d_out[i] - d_in[i]); // = rbeta*(beta*(b - sum_j!=i(alpha*in))) - rbeta*in = b - sum(alpha*in) = b - A*x(k)
-                sum += res * res;
-            }
-
-// info: in nvvp profile 8byte size copy from to device to/from pageable due to sum!
+            sum = JacobiStep(dst, src, b, alphaX, alphaY, alphaZ, rbeta, dsign, w, sync);
+            boundary->applyBoundary(dst->data, type, sync);
 
 #pragma acc wait
             res = sqrt(sum);
             it++;
-
-// swap (no pointer swap due to uncontrolled behavior in TimeIntegration Update)
-#pragma acc parallel loop independent present(d_out[:bsize], d_in[:bsize], d_iList[:bsize_i]) async
-            for (size_t j = 0; j < bsize_i; ++j) {
-                const size_t i = d_iList[j];
-                d_in[i] = d_out[i];
-            }
-
-#pragma acc parallel loop independent present(d_out[:bsize], d_in[:bsize], d_bList[:bsize_b]) async
-            for (size_t j = 0; j < bsize_b; ++j) {
-                const size_t i = d_bList[j];
-                d_in[i] = d_out[i];
-            }
+            std::swap(dst, src);
         } //end while
 
-        if (it % 2 != 0) // swap necessary when odd number of iterations
-        {
+        if (it > 0 && it % 2 == 0) { // result in in when even number of iterations
+#pragma omp parallel for
 #pragma acc parallel loop independent present(d_out[:bsize], d_in[:bsize], d_iList[:bsize_i]) async
             for (size_t j = 0; j < bsize_i; ++j) {
                 const size_t i = d_iList[j];
                 d_out[i] = d_in[i];
             }
 
+#pragma omp parallel for
 #pragma acc parallel loop independent present(d_out[:bsize], d_in[:bsize], d_bList[:bsize_b]) async
             for (size_t j = 0; j < bsize_b; ++j) {
                 const size_t i = d_bList[j];
                 d_out[i] = d_in[i];
             }
+#pragma omp parallel for
+#pragma acc parallel loop independent present(d_out[:bsize], d_in[:bsize], d_oList[:bsize_o]) async
+            for (size_t j = 0; j < bsize_o; ++j) {
+                const size_t i = d_oList[j];
+                d_out[i] = d_in[i];
+            }
         }
 
         if (sync) {
@@ -145,7 +135,7 @@ void JacobiDiffuse::diffuse(Field *out, Field *in, const Field *b, const real D,
 /// \brief  solves turbulent diffusion equation \f$ \partial_t \phi_2 = \nu \ nabla^2 \phi_2 \f$
 ///     via calculated iterations of Jacobi step (dependent on residual/ maximal iterations)
 /// \param  out     output pointer
-/// \param  in      input pointer
+/// \param  in      input pointer (initial guess, used as second buffer, overwritten)
 /// \param  b       source pointer
 /// \param  D     diffusion coefficient (nu - velocity, kappa - temperature)
 /// \param  EV      turbulent diffusion coefficient (eddy viscosity)
@@ -166,24 +156,16 @@ void JacobiDiffuse::diffuse(Field *out, Field *in, const Field *b, const real D,
 
     size_t *d_iList = boundary->get_innerList_level_joined();
     size_t *d_bList = boundary->get_boundaryList_level_joined();
+    size_t *d_oList = boundary->get_obstacleList();
 
     auto bsize_i = boundary->getSize_innerList();
     auto bsize_b = boundary->getSize_boundaryList();
+    auto bsize_o = boundary->getSize_obstacleList();
 
 #pragma acc data present(d_out[:bsize], d_in[:bsize], d_b[:bsize], d_EV[:bsize])
     {
-        const real dx = domain->get_dx(out->get_level()); //due to unnecessary parameter passing of *this
-        const real dy = domain->get_dy(out->get_level());
-        const real dz = domain->get_dz(out->get_level());
-
-        const real rdx = 1. / dx; //due to unnecessary parameter passing of *this
-        const real rdy = 1. / dy;
-        const real rdz = 1. / dz;
-
         real dt = m_dt;
 
-        real alphaX, alphaY, alphaZ, rbeta; //calculated in JacobiStep!
-
         const real dsign = m_dsign;
         const real w = m_w;
 
@@ -193,56 +175,38 @@ void JacobiDiffuse::diffuse(Field *out, Field *in, const Field *b, const real D,
         real sum;
         real res = 1.;
 
+        // out and in are used as ping-pong buffers, odd iterations write into out, even ones into in
+        Field *dst = out;
+        Field *src = in;
         while (res > tol_res && it < max_it) {
-            JacobiStep(out, in, b, dsign, w, D, EV, dt, sync);
-            boundary->applyBoundary(d_out, type, sync);
-
-            sum = 0.;
-
-#pragma acc parallel loop independent present(d_out[:bsize], d_b[:bsize], d_EV[:bsize], d_iList[:bsize_i]) async
-            for (size_t j = 0; j < bsize_i; ++j) {
-                const size_t i = d_iList[j];
-                alphaX = (D + d_EV[i]) * dt * rdx * rdx;
-                alphaY = (D + d_EV[i]) * dt * rdy * rdy;
-                alphaZ = (D + d_EV[i]) * dt * rdz * rdz;
-                rbeta = (1. + 2. * (alphaX + alphaY + alphaZ));
-
-                res = rbeta * (d_out[i] - d_in[i]);
-                sum += res * res;
-            }
-
-// info: in nvvp profile 8byte size copy from to device to/from pageable due to sum!
+            sum = JacobiStep(dst, src, b, dsign, w, D, EV, dt, sync);
+            boundary->applyBoundary(dst->data, type, sync);
 
 #pragma acc wait
             res = sqrt(sum);
             it++;
-
-// swap (no pointer swap due to uncontrolled behavior in TimeIntegration Update)
-#pragma acc parallel loop independent present(d_out[:bsize], d_in[:bsize], d_iList[:bsize_i]) async
-            for (size_t j = 0; j < bsize_i; ++j) {
-                const size_t i = d_iList[j];
-                d_in[i] = d_out[i];
-            }
-#pragma acc parallel loop independent present(d_out[:bsize], d_in[:bsize], d_bList[:bsize_b]) async
-            for (size_t j = 0; j < bsize_b; ++j) {
-                const size_t i = d_bList[j];
-                d_in[i] = d_out[i];
-            }
-
+            std::swap(dst, src);
         } //end while
 
-        if (it % 2 != 0)// swap necessary when odd number of iterations
-        {
+        if (it > 0 && it % 2 == 0) { // result in in when even number of iterations
+#pragma omp parallel for
 #pragma acc parallel loop independent present(d_out[:bsize], d_in[:bsize], d_iList[:bsize_i]) async
             for (size_t j = 0; j < bsize_i; ++j) {
                 const size_t i = d_iList[j];
                 d_out[i] = d_in[i];
             }
+#pragma omp parallel for
 #pragma acc parallel loop independent present(d_out[:bsize], d_in[:bsize], d_bList[:bsize_b]) async
             for (size_t j = 0; j < bsize_b; ++j) {
                 const size_t i = d_bList[j];
                 d_out[i] = d_in[i];
             }
+#pragma omp parallel for
+#pragma acc parallel loop independent present(d_out[:bsize], d_in[:bsize], d_oList[:bsize_o]) async
+            for (size_t j = 0; j < bsize_o; ++j) {
+                const size_t i = d_oList[j];
+                d_out[i] = d_in[i];
+            }
         }
 
         if (sync) {
@@ -271,8 +235,9 @@ void JacobiDiffuse::diffuse(Field *out, Field *in, const Field *b, const real D,
 /// \param  dsign sign (\a -1. for pressure, \a 1. else)
 /// \param  w   weight (1. - diffusion, 2./3. - multigrid)
 /// \param  sync  synchronous kernel launching (true, default: false)
+/// \return squared norm of the residual \f$ \|b - A x^{(n)}\|^2 \f$ over inner cells, computed in the same sweep
 // ***************************************************************************************
-void JacobiDiffuse::JacobiStep(Field *out, const Field *in, const Field *b, const real alphaX, const real alphaY, const real alphaZ, const real rbeta, const real dsign, const real w, bool sync) {
+real JacobiDiffuse::JacobiStep(Field *out, const Field *in, const Field *b, const real alphaX, const real alphaY, const real alphaZ, const real rbeta, const real dsign, const real w, bool sync) {
     auto domain = Domain::getInstance();
     // local variables and parameters for GPU
     const size_t Nx = domain->get_Nx(out->get_level()); //due to unnecessary parameter passing of *this
@@ -286,21 +251,59 @@ void JacobiDiffuse::JacobiStep(Field *out, const Field *in, const Field *b, cons
 
     auto boundary = BoundaryController::getInstance();
 
-    size_t *d_iList = boundary->get_innerList_level_joined();
-    auto bsize_i = boundary->getSize_innerList();
-
-#pragma acc parallel loop independent present(d_out[:bsize], d_in[:bsize], d_b[:bsize], d_iList[:bsize_i]) async
-    for (size_t j = 0; j < bsize_i; ++j) {
-        const size_t i = d_iList[j];
-        real out_h = (dsign * d_b[i] + alphaX * (d_in[i + 1] + d_in[i - 1]) \
+    size_t *d_rStart = boundary->get_innerRuns_start_level_joined();
+    size_t *d_rLen = boundary->get_innerRuns_length_level_joined();
+    size_t bsize_r = boundary->get_innerRuns_level_joined_end(0) + 1;
+
+    real sum = 0.;
+
+    if (!boundary->hasObstacles()) {
+        // inner cells form a dense box, iterate structured without index list
+        const size_t i1 = domain->get_index_x1(out->get_level());
+        const size_t i2 = domain->get_index_x2(out->get_level());
+        const size_t j1 = domain->get_index_y1(out->get_level());
+        const size_t j2 = domain->get_index_y2(out->get_level());
+        const size_t k1 = domain->get_index_z1(out->get_level());
+        const size_t k2 = domain->get_index_z2(out->get_level());
+
+#pragma omp parallel for collapse(2) reduction(+:sum)
+#pragma acc parallel loop independent collapse(3) present(d_out[:bsize], d_in[:bsize], d_b[:bsize]) reduction(+:sum)
+        for (size_t k = k1; k <= k2; ++k) {
+            for (size_t j = j1; j <= j2; ++j) {
+                for (size_t i = i1; i <= i2; ++i) {
+                    const size_t idx = IX(i, j, k, Nx, Ny);
+                    real out_h = (dsign * d_b[idx] + alphaX * (d_in[idx + 1] + d_in[idx - 1]) \
+ + alphaY * (d_in[idx + Nx] + d_in[idx - Nx]) \
+ + alphaZ * (d_in[idx + Nx * Ny] + d_in[idx - Nx * Ny])) / rbeta;
+                    d_out[idx] = (1 - w) * d_in[idx] + w * out_h;
+                    const real res_i = rbeta * (d_out[idx] - d_in[idx]); // = b - A*x(k)
+                    sum += res_i * res_i;
+                }
+            }
+        }
+    } else {
+        // inner cells as runs of consecutive indices, unit stride within each run
+#pragma omp parallel for reduction(+:sum)
+#pragma acc parallel loop independent present(d_out[:bsize], d_in[:bsize], d_b[:bsize], d_rStart[:bsize_r], d_rLen[:bsize_r]) reduction(+:sum)
+        for (size_t r = 0; r < bsize_r; ++r) {
+            const size_t first = d_rStart[r];
+            const size_t last = first + d_rLen[r];
+#pragma acc loop independent reduction(+:sum)
+            for (size_t i = first; i < last; ++i) {
+                real out_h = (dsign * d_b[i] + alphaX * (d_in[i + 1] + d_in[i - 1]) \
  + alphaY * (d_in[i + Nx] + d_in[i - Nx]) \
  + alphaZ * (d_in[i + Nx * Ny] + d_in[i - Nx * Ny])) / rbeta;
-        d_out[i] = (1 - w) * d_in[i] + w * out_h;
+                d_out[i] = (1 - w) * d_in[i] + w * out_h;
+                const real res_i = rbeta * (d_out[i] - d_in[i]);
+                sum += res_i * res_i;
+            }
+        }
     }
 
     if (sync) {
 #pragma acc wait
     }
+    return sum;
 }
 
 // =============== Multigrid version for Jacobian stencil ===============
@@ -321,7 +324,8 @@ void JacobiDiffuse::JacobiStep(Field *out, const Field *in, const Field *b, cons
 /// \param  w   weight (1. - diffusion, 2./3. - multigrid)
 /// \param  sync  synchronous kernel launching (true, default: false)
 // ***************************************************************************************
-void JacobiDiffuse::JacobiStep(size_t level, Field *out, const Field *in, const Field *b, const real alphaX, const real alphaY, const real alphaZ, const real beta, const real dsign, const real w, bool sync) {
+template<typename T>
+void JacobiDiffuse::JacobiStep(size_t level, FieldT<T> *out, const FieldT<T> *in, const FieldT<T> *b, const real alphaX, const real alphaY, const real alphaZ, const real beta, const real dsign, const real w, bool sync) {
     auto domain = Domain::getInstance();
     // local variables and parameters for GPU
     const size_t Nx = domain->get_Nx(level); //due to unnecessary parameter passing of *this
@@ -335,17 +339,48 @@ void JacobiDiffuse::JacobiStep(size_t level, Field *out, const Field *in, const
 
     auto boundary = BoundaryController::getInstance();
 
-    size_t *d_iList = boundary->get_innerList_level_joined();
-    size_t start_i = boundary->get_innerList_level_joined_start(level);
-    size_t end_i = boundary->get_innerList_level_joined_end(level) + 1;
-
-#pragma acc parallel loop independent present(d_out[:bsize], d_in[:bsize], d_b[:bsize], d_iList[start_i:(end_i-start_i)]) async
-    for (size_t j = start_i; j < end_i; ++j) {
-        const size_t i = d_iList[j];
-        real out_h = beta * (dsign * d_b[i] + alphaX * (d_in[i + 1] + d_in[i - 1]) \
+    size_t *d_rStart = boundary->get_innerRuns_start_level_joined();
+    size_t *d_rLen = boundary->get_innerRuns_length_level_joined();
+    size_t start_r = boundary->get_innerRuns_level_joined_start(level);
+    size_t end_r = boundary->get_innerRuns_level_joined_end(level) + 1;
+
+    if (!boundary->hasObstacles()) {
+        // inner cells form a dense box, iterate structured without index list
+        const size_t i1 = domain->get_index_x1(level);
+        const size_t i2 = domain->get_index_x2(level);
+        const size_t j1 = domain->get_index_y1(level);
+        const size_t j2 = domain->get_index_y2(level);
+        const size_t k1 = domain->get_index_z1(level);
+        const size_t k2 = domain->get_index_z2(level);
+
+#pragma omp parallel for collapse(2)
+#pragma acc parallel loop independent collapse(3) present(d_out[:bsize], d_in[:bsize], d_b[:bsize]) async
+        for (size_t k = k1; k <= k2; ++k) {
+            for (size_t j = j1; j <= j2; ++j) {
+                for (size_t i = i1; i <= i2; ++i) {
+                    const size_t idx = IX(i, j, k, Nx, Ny);
+                    real out_h = beta * (dsign * d_b[idx] + alphaX * (d_in[idx + 1] + d_in[idx - 1]) \
+ + alphaY * (d_in[idx + Nx] + d_in[idx - Nx]) \
+ + alphaZ * (d_in[idx + Nx * Ny] + d_in[idx - Nx * Ny]));
+                    d_out[idx] = (1 - w) * d_in[idx] + w * out_h;
+                }
+            }
+        }
+    } else {
+        // inner cells as runs of consecutive indices, unit stride within each run
+#pragma omp parallel for
+#pragma acc parallel loop independent present(d_out[:bsize], d_in[:bsize], d_b[:bsize], d_rStart[start_r:(end_r-start_r)], d_rLen[start_r:(end_r-start_r)]) async
+        for (size_t r = start_r; r < end_r; ++r) {
+            const size_t first = d_rStart[r];
+            const size_t last = first + d_rLen[r];
+#pragma acc loop independent
+            for (size_t i = first; i < last; ++i) {
+                real out_h = beta * (dsign * d_b[i] + alphaX * (d_in[i + 1] + d_in[i - 1]) \
  + alphaY * (d_in[i + Nx] + d_in[i - Nx]) \
  + alphaZ * (d_in[i + Nx * Ny] + d_in[i - Nx * Ny]));
-        d_out[i] = (1 - w) * d_in[i] + w * out_h;
+                d_out[i] = (1 - w) * d_in[i] + w * out_h;
+            }
+        }
     }
 
     if (sync) {
@@ -365,8 +400,9 @@ void JacobiDiffuse::JacobiStep(size_t level, Field *out, const Field *in, const
 /// \param  EV    turbulent diffusion coefficient (eddy viscosity)
 /// \param  dt    time step
 /// \param  sync  synchronous kernel launching (true, default: false)
+/// \return squared norm of the residual \f$ \|b - A x^{(n)}\|^2 \f$ over inner cells, computed in the same sweep
 // ***************************************************************************************
-void JacobiDiffuse::JacobiStep(Field *out, const Field *in, const Field *b, const real dsign, const real w, const real D, const Field *EV, const real dt, bool sync) {
+real JacobiDiffuse::JacobiStep(Field *out, const Field *in, const Field *b, const real dsign, const real w, const real D, const Field *EV, const real dt, bool sync) {
     auto domain = Domain::getInstance();
     // local variables and parameters for GPU
     const size_t Nx = domain->get_Nx(out->get_level()); //due to unnecessary parameter passing of *this
@@ -382,8 +418,6 @@ void JacobiDiffuse::JacobiStep(Field *out, const Field *in, const Field *b, cons
 
     auto bsize = domain->get_size(out->get_level());
 
-    real aX, aY, aZ, bb, rb; //multipliers calculated
-
     auto d_out = out->data;
     auto d_in = in->data;
     auto d_b = b->data;
@@ -391,26 +425,76 @@ void JacobiDiffuse::JacobiStep(Field *out, const Field *in, const Field *b, cons
 
     auto boundary = BoundaryController::getInstance();
 
-    size_t *d_iList = boundary->get_innerList_level_joined();
-    auto bsize_i = boundary->getSize_innerList();
-
-#pragma acc parallel loop independent present(d_out[:bsize], d_in[:bsize], d_b[:bsize], d_EV[:bsize], d_iList[:bsize_i]) async
-    for (size_t j = 0; j < bsize_i; ++j) {
-        const size_t i = d_iList[j];
-        aX = (D + d_EV[i]) * dt * rdx * rdx;
-        aY = (D + d_EV[i]) * dt * rdy * rdy;
-        aZ = (D + d_EV[i]) * dt * rdz * rdz;
-
-        rb = (1. + 2. * (aX + aY + aZ));
-        bb = 1. / rb;
-
-        real out_h = bb * (dsign * d_b[i] + aX * (d_in[i + 1] + d_in[i - 1]) \
+    size_t *d_rStart = boundary->get_innerRuns_start_level_joined();
+    size_t *d_rLen = boundary->get_innerRuns_length_level_joined();
+    size_t bsize_r = boundary->get_innerRuns_level_joined_end(0) + 1;
+
+    real sum = 0.;
+
+    if (!boundary->hasObstacles()) {
+        // inner cells form a dense box, iterate structured without index list
+        const size_t i1 = domain->get_index_x1(out->get_level());
+        const size_t i2 = domain->get_index_x2(out->get_level());
+        const size_t j1 = domain->get_index_y1(out->get_level());
+        const size_t j2 = domain->get_index_y2(out->get_level());
+        const size_t k1 = domain->get_index_z1(out->get_level());
+        const size_t k2 = domain->get_index_z2(out->get_level());
+
+#pragma omp parallel for collapse(2) reduction(+:sum)
+#pragma acc parallel loop independent collapse(3) present(d_out[:bsize], d_in[:bsize], d_b[:bsize], d_EV[:bsize]) reduction(+:sum)
+        for (size_t k = k1; k <= k2; ++k) {
+            for (size_t j = j1; j <= j2; ++j) {
+                for (size_t i = i1; i <= i2; ++i) {
+                    const size_t idx = IX(i, j, k, Nx, Ny);
+                    const real aX = (D + d_EV[idx]) * dt * rdx * rdx;
+                    const real aY = (D + d_EV[idx]) * dt * rdy * rdy;
+                    const real aZ = (D + d_EV[idx]) * dt * rdz * rdz;
+
+                    const real rb = (1. + 2. * (aX + aY + aZ));
+                    const real bb = 1. / rb;
+
+                    real out_h = bb * (dsign * d_b[idx] + aX * (d_in[idx + 1] + d_in[idx - 1]) \
+ + aY * (d_in[idx + Nx] + d_in[idx - Nx]) \
+ + aZ * (d_in[idx + Nx * Ny] + d_in[idx - Nx * Ny]));
+                    d_out[idx] = (1 - w) * d_in[idx] + w * out_h;
+                    const real res_i = rb * (d_out[idx] - d_in[idx]);
+                    sum += res_i * res_i;
+                }
+            }
+        }
+    } else {
+        // inner cells as runs of consecutive indices, unit stride within each run
+#pragma omp parallel for reduction(+:sum)
+#pragma acc parallel loop independent present(d_out[:bsize], d_in[:bsize], d_b[:bsize], d_EV[:bsize], d_rStart[:bsize_r], d_rLen[:bsize_r]) reduction(+:sum)
+        for (size_t r = 0; r < bsize_r; ++r) {
+            const size_t first = d_rStart[r];
+            const size_t last = first + d_rLen[r];
+#pragma acc loop independent reduction(+:sum)
+            for (size_t i = first; i < last; ++i) {
+                const real aX = (D + d_EV[i]) * dt * rdx * rdx;
+                const real aY = (D + d_EV[i]) * dt * rdy * rdy;
+                const real aZ = (D + d_EV[i]) * dt * rdz * rdz;
+
+                const real rb = (1. + 2. * (aX + aY + aZ));
+                const real bb = 1. / rb;
+
+                real out_h = bb * (dsign * d_b[i] + aX * (d_in[i + 1] + d_in[i - 1]) \
  + aY * (d_in[i + Nx] + d_in[i - Nx]) \
  + aZ * (d_in[i + Nx * Ny] + d_in[i - Nx * Ny]));
-        d_out[i] = (1 - w) * d_in[i] + w * out_h;
+                d_out[i] = (1 - w) * d_in[i] + w * out_h;
+                const real res_i = rb * (d_out[i] - d_in[i]);
+                sum += res_i * res_i;
+            }
+        }
     }
 
     if (sync) {
 #pragma acc wait
     }
+    return sum;
 }
+
+template void JacobiDiffuse::JacobiStep<real>(size_t level, Field *out, const Field *in, const Field *b, real alphaX, real alphaY, real alphaZ, real beta, real dsign, real w, bool sync);
+#ifdef MIXED_PRECISION
+template void JacobiDiffuse::JacobiStep<real_lp>(size_t level, FieldLP *out, const FieldLP *in, const FieldLP *b, real alphaX, real alphaY, real alphaZ, real beta, real dsign, real w, bool sync);
+#endif
@@ -19,9 +19,10 @@ public:
     void diffuse(Field *out, Field *in, const Field *b, real D, bool sync) override;
     void diffuse(Field *out, Field *in, const Field *b, real D, const Field *EV, bool sync) override;  // turbulent version
 
-    static void JacobiStep(Field *out, const Field *in, const Field *b, real alphaX, real alphaY, real alphaZ, real beta, real dsign, real w, bool sync = true);
-    static void JacobiStep(size_t level, Field *out, const Field *in, const Field *b, real alphaX, real alphaY, real alphaZ, real beta, real dsign, real w, bool sync = true); // Multigrid version
-    static void JacobiStep(Field *out, const Field *in, const Field *b, real dsign, real w, real D, const Field *EV, real dt, bool sync = true); // turbulent version
+    static real JacobiStep(Field *out, const Field *in, const Field *b, real alphaX, real alphaY, real alphaZ, real beta, real dsign, real w, bool sync = true);
+    template<typename T>
+    static void JacobiStep(size_t level, FieldT<T> *out, const FieldT<T> *in, const FieldT<T> *b, real alphaX, real alphaY, real alphaZ, real beta, real dsign, real w, bool sync = true); // Multigrid version
+    static real JacobiStep(Field *out, const Field *in, const Field *b, real dsign, real w, real D, const Field *EV, real dt, bool sync = true); // turbulent version
 
 private:
 #ifndef BENCHMARKING
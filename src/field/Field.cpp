@@ -6,38 +6,40 @@
 
 #include <cmath>
 #include "Field.h"
+#include "FieldArena.h"
 #include "../Domain.h"
 
-Field::Field(FieldType type, real val): m_type(type){
-    size_t size = Domain::getInstance()->get_size();
+template<typename T>
+FieldT<T>::FieldT(FieldType type, real val): m_type(type){
 	m_level = 0;
-    data = new real[size];
-    std::fill( data, data + size, val);
+    data = FieldArena<T>::getInstance(m_level)->allocate(static_cast<T>(val));
 }
 
-Field::Field(FieldType type, real val, size_t level): m_level(level), m_type(type) {
-	size_t size = Domain::getInstance()->get_size(level);
-
-	data = new real[size];
-	std::fill( data, data + size, val);
+template<typename T>
+FieldT<T>::FieldT(FieldType type, real val, size_t level): m_level(level), m_type(type) {
+	data = FieldArena<T>::getInstance(m_level)->allocate(static_cast<T>(val));
 }
 
-void Field::set_value(real val){
+template<typename T>
+void FieldT<T>::set_value(real val){
     size_t size = Domain::getInstance()->get_size(m_level);
-    std::fill(data, data + size, val);
+    std::fill(data, data + size, static_cast<T>(val));
 }
 
-Field::~Field(){
-	delete[] data;
+template<typename T>
+FieldT<T>::~FieldT(){
+	FieldArena<T>::getInstance(m_level)->release(data);
 }
 
 //=============================== Copy Constructor ======================================
-Field::Field(const Field & other){
-    size_t size = Domain::getInstance()->get_size(other.m_level);
-	data = new real[size];
-	for (size_t i = 0; i < size; i++){
-		data[i] = other.data[i];
-	}
+template<typename T>
+FieldT<T>::FieldT(const FieldT & other){
+	data = FieldArena<T>::getInstance(other.m_level)->allocate(other.data);
 	m_type = other.m_type;
 	m_level = other.m_level;
 }
+
+template class FieldT<real>;
+#ifdef MIXED_PRECISION
+template class FieldT<real_lp>;
+#endif
@@ -18,27 +18,32 @@ enum FieldType : int {
 };
 #endif
 
-class Field {
+/// \brief  field of data type T (real for solver state, real_lp for low precision storage)
+template<typename T>
+class FieldT {
 public:
-    Field(FieldType type, real val);
-    Field(FieldType type, real val, size_t level);
+    FieldT(FieldType type, real val);
+    FieldT(FieldType type, real val, size_t level);
 
-    ~Field();
-    Field(const Field &);
+    ~FieldT();
+    FieldT(const FieldT &);
 
     // getter
     FieldType get_type() { return this->m_type; };
     size_t get_level() { return this->m_level; };
 
     void set_value(real val);
-    static void swap(Field *a, Field *b) { std::swap(a->data, b->data); };
+    static void swap(FieldT *a, FieldT *b) { std::swap(a->data, b->data); };
 
-    real *data;
+    T *data;
 
 private:
     size_t m_level;
     FieldType m_type;
 };
 
+typedef FieldT<real> Field;      // solver state
+typedef FieldT<real_lp> FieldLP; // multigrid levels and turbulence scratch (float in mixed precision builds)
+
 
 #endif /* ARTSS_FIELD_H_ */
@@ -0,0 +1,125 @@
+/// \file       FieldArena.cpp
+/// \brief      Pool allocator for the data arrays of all fields of one multigrid level
+/// \date       Oct 17, 2026
+/// \author     ARTSS developers
+/// \copyright  <2015-2020> Forschungszentrum Juelich GmbH. All rights reserved.
+
+#include <cstdlib>
+#include <new>
+#include "FieldArena.h"
+#include "../Domain.h"
+
+template<typename T>
+std::vector<FieldArena<T> *> FieldArena<T>::instances;
+template<typename T>
+std::mutex FieldArena<T>::instances_mutex;
+
+template<typename T>
+FieldArena<T>::FieldArena(size_t level) {
+    m_size = Domain::getInstance()->get_size(level);
+
+    // round up to full cache lines and pad to an odd number of lines
+    size_t lines = (m_size * sizeof(T) + cache_line - 1) / cache_line;
+    if (lines % 2 == 0) {
+        lines++;
+    }
+    m_stride = lines * cache_line / sizeof(T);
+}
+
+template<typename T>
+FieldArena<T>::~FieldArena() {
+    for (T *block: m_blocks) {
+        std::free(block);
+    }
+}
+
+// ================================== Get instance ======================================
+// ***************************************************************************************
+/// \brief  returns the arena of the given multigrid level (created on first use)
+/// \param  level   multigrid level
+// ***************************************************************************************
+template<typename T>
+FieldArena<T> *FieldArena<T>::getInstance(size_t level) {
+    std::lock_guard<std::mutex> lock(instances_mutex);
+    if (instances.size() <= level) {
+        instances.resize(level + 1, nullptr);
+    }
+    if (instances[level] == nullptr) {
+        instances[level] = new FieldArena(level);
+    }
+    return instances[level];
+}
+
+// ==================================== Next slot =======================================
+// ***************************************************************************************
+/// \brief  takes a free slot, a new block of slots is reserved if the pool is exhausted.
+///         Pages of a new block are not touched here, but when the slot is handed out.
+// ***************************************************************************************
+template<typename T>
+T *FieldArena<T>::next_slot() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_free.empty()) {
+        size_t bytes = slots_per_block * m_stride * sizeof(T);
+        auto block = static_cast<T *>(std::aligned_alloc(cache_line, bytes));
+        if (block == nullptr) {
+            throw std::bad_alloc();
+        }
+        m_blocks.push_back(block);
+        // hand out in ascending order
+        for (size_t s = slots_per_block; s > 0; s--) {
+            m_free.push_back(block + (s - 1) * m_stride);
+        }
+    }
+    T *data = m_free.back();
+    m_free.pop_back();
+    return data;
+}
+
+// ==================================== Allocate ========================================
+// ***************************************************************************************
+/// \brief  returns a slot initialized with a constant value (first touch)
+/// \param  val   initial value
+// ***************************************************************************************
+template<typename T>
+T *FieldArena<T>::allocate(T val) {
+    T *data = next_slot();
+    size_t size = m_size;
+#pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < size; i++) {
+        data[i] = val;
+    }
+    return data;
+}
+
+// ***************************************************************************************
+/// \brief  returns a slot initialized with a copy of src (first touch)
+/// \param  src   data of the same level
+// ***************************************************************************************
+template<typename T>
+T *FieldArena<T>::allocate(const T *src) {
+    T *data = next_slot();
+    size_t size = m_size;
+#pragma omp parallel for schedule(static)
+    for (size_t i = 0; i < size; i++) {
+        data[i] = src[i];
+    }
+    return data;
+}
+
+// ==================================== Release =========================================
+// ***************************************************************************************
+/// \brief  returns a slot to the pool, memory is kept for the next field of this level
+/// \param  data   slot obtained by allocate
+// ***************************************************************************************
+template<typename T>
+void FieldArena<T>::release(T *data) {
+    if (data != nullptr) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_free.push_back(data);
+    }
+}
+
+template class FieldArena<real>;
+#ifdef MIXED_PRECISION
+template class FieldArena<real_lp>;
+#endif
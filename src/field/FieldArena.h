@@ -0,0 +1,51 @@
+/// \file       FieldArena.h
+/// \brief      Pool allocator for the data arrays of all fields of one multigrid level
+/// \date       Oct 17, 2026
+/// \author     ARTSS developers
+/// \copyright  <2015-2020> Forschungszentrum Juelich GmbH. All rights reserved.
+
+#ifndef ARTSS_FIELD_FIELDARENA_H_
+#define ARTSS_FIELD_FIELDARENA_H_
+
+#include <mutex>
+#include <vector>
+#include "../utility/GlobalMacrosTypes.h"
+
+/// \brief  hands out the data arrays of fields of one level from large 64 byte aligned blocks.
+///         Slots are padded to an odd number of cache lines, so that the same index of
+///         different fields does not map to the same cache set. Pages are first touched
+///         in parallel with the (static) loop decomposition of the compute kernels.
+///         Fields may be created and destroyed from any thread, the list of arenas and the
+///         free slots of an arena are guarded by mutexes.
+template<typename T>
+class FieldArena {
+public:
+    static FieldArena *getInstance(size_t level);
+
+    T *allocate(T val);
+    T *allocate(const T *src);
+    void release(T *data);
+
+    size_t get_size() const { return m_size; }
+    size_t get_stride() const { return m_stride; }
+
+    static constexpr size_t cache_line = 64;  // alignment and padding unit in bytes
+    static constexpr size_t slots_per_block = 32;  // roughly all fields of FieldController
+
+private:
+    explicit FieldArena(size_t level);
+    ~FieldArena();
+
+    T *next_slot();
+
+    static std::vector<FieldArena *> instances;
+    static std::mutex instances_mutex;
+
+    size_t m_size;    // number of cells of the level
+    size_t m_stride;  // distance of two slots in elements
+    std::vector<T *> m_blocks;
+    std::vector<T *> m_free;
+    std::mutex m_mutex;  // guards m_blocks and m_free
+};
+
+#endif /* ARTSS_FIELD_FIELDARENA_H_ */
@@ -249,6 +249,7 @@ void FieldController::update_data(bool sync) {
                             d_p[:bsize], d_p0[:bsize], d_T[:bsize], d_T0[:bsize], d_T_tmp[:bsize], d_C[:bsize], d_C0[:bsize], d_C_tmp[:bsize])
     {
         // inner
+#pragma omp parallel for
 #pragma acc parallel loop independent present(    d_iList[:bsize_i], d_u[:bsize], d_v[:bsize], d_w[:bsize], \
                                                 d_u0[:bsize], d_v0[:bsize], d_w0[:bsize], d_u_tmp[:bsize], d_v_tmp[:bsize], d_w_tmp[:bsize], \
                                                 d_p[:bsize], d_p0[:bsize], d_T[:bsize], d_T0[:bsize], d_T_tmp[:bsize], \
@@ -268,6 +269,7 @@ void FieldController::update_data(bool sync) {
             d_C_tmp[idx] = d_C[idx];
         }
         // boundary
+#pragma omp parallel for
 #pragma acc parallel loop independent present(d_bList[:bsize_b], d_u[:bsize], d_v[:bsize], d_w[:bsize], d_u0[:bsize], d_v0[:bsize], d_w0[:bsize], d_u_tmp[:bsize], d_v_tmp[:bsize], d_w_tmp[:bsize], d_p[:bsize], d_p0[:bsize], d_T[:bsize], d_T0[:bsize], d_T_tmp[:bsize], d_C[:bsize], d_C0[:bsize], d_C_tmp[:bsize]) async
         for (size_t j = 0; j < bsize_b; ++j) {
             const size_t idx = d_bList[j];
@@ -284,6 +286,7 @@ void FieldController::update_data(bool sync) {
             d_C_tmp[idx] = d_C[idx];
         }
         // obstacles
+#pragma omp parallel for
 #pragma acc parallel loop independent present(d_oList[:bsize_o], d_u[:bsize], d_v[:bsize], d_w[:bsize], d_u0[:bsize], d_v0[:bsize], d_w0[:bsize], d_u_tmp[:bsize], d_v_tmp[:bsize], d_w_tmp[:bsize], d_p[:bsize], d_p0[:bsize], d_T[:bsize], d_T0[:bsize], d_T_tmp[:bsize], d_C[:bsize], d_C0[:bsize], d_C_tmp[:bsize]) async
         for (size_t j = 0; j < bsize_o; ++j) {
             const size_t idx = d_oList[j];
@@ -348,6 +351,7 @@ void FieldController::couple_vector(const Field *a, Field *a0, Field *a_tmp, con
                             d_c[:size], d_c0[:size], d_c_tmp[:size], d_iList[:bsize_i], d_bList[:bsize_b], d_oList[:bsize_o])
     {
         // inner
+#pragma omp parallel for
 #pragma acc kernels async
 #pragma acc loop independent
         for (size_t j = 0; j < bsize_i; ++j) {
@@ -360,6 +364,7 @@ void FieldController::couple_vector(const Field *a, Field *a0, Field *a_tmp, con
             d_c_tmp[i] = d_c[i];
         }
         // boundary
+#pragma omp parallel for
 #pragma acc kernels async
 #pragma acc loop independent
         for (size_t j = 0; j < bsize_b; ++j) {
@@ -372,6 +377,7 @@ void FieldController::couple_vector(const Field *a, Field *a0, Field *a_tmp, con
             d_c_tmp[i] = d_c[i];
         }
         // obstacles
+#pragma omp parallel for
 #pragma acc kernels async
 #pragma acc loop independent
         for (size_t j = 0; j < bsize_o; ++j) {
@@ -419,6 +425,7 @@ void FieldController::couple_scalar(const Field *a, Field *a0, Field *a_tmp, boo
 #pragma acc data present(d_a[:size], d_a0[:size], d_a_tmp[:size], d_iList[:bsize_i], d_bList[:bsize_b], d_oList[:bsize_o])
     {
         // inner
+#pragma omp parallel for
 #pragma acc kernels async
 #pragma acc loop independent
         for (size_t j = 0; j < bsize_i; ++j) {
@@ -427,6 +434,7 @@ void FieldController::couple_scalar(const Field *a, Field *a0, Field *a_tmp, boo
             d_a_tmp[i] = d_a[i];
         }
         // boundary
+#pragma omp parallel for
 #pragma acc kernels async
 #pragma acc loop independent
         for (size_t j = 0; j < bsize_b; ++j) {
@@ -435,6 +443,7 @@ void FieldController::couple_scalar(const Field *a, Field *a0, Field *a_tmp, boo
             d_a_tmp[i] = d_a[i];
         }
         // obstacles
+#pragma omp parallel for
 #pragma acc kernels async
 #pragma acc loop independent
         for (size_t j = 0; j < bsize_o; ++j) {
@@ -448,6 +457,74 @@ void FieldController::couple_scalar(const Field *a, Field *a0, Field *a_tmp, boo
     }//end data region
 }
 
+//======================================== Rotate velocity ====================================
+// ***************************************************************************************
+/// \brief  hands the current solution over to the temporal fields by swapping the data
+///         pointers instead of copying (a_tmp takes the buffer of a and vice versa). Only the
+///         boundary and obstacle cells are copied back to a, since applyBoundary does not set
+///         all of them (e.g. ghost cells below an obstacle touching the domain boundary).
+///         The inner cells of a are outdated and have to be overwritten by the next operation
+///         (e.g. projection). The zero-th fields are not touched, they are coupled again in update_data.
+/// \param  a   current field in x- direction
+/// \param  a_tmp temporal field in x- direction
+/// \param  b   current field in y- direction
+/// \param  b_tmp temporal field in y- direction
+/// \param  c   current field in z- direction
+/// \param  c_tmp temporal field in z- direction
+/// \param  sync  synchronization boolean (true=sync (default), false=async)
+// ***************************************************************************************
+void FieldController::rotate_vector(Field *a, Field *a_tmp, Field *b, Field *b_tmp, Field *c, Field *c_tmp, bool sync) {
+    // all buffers are present on the device, only the host pointers (keys of the present table) are exchanged
+    Field::swap(a, a_tmp);
+    Field::swap(b, b_tmp);
+    Field::swap(c, c_tmp);
+
+    // local variables and parameters for GPU
+    auto d_a = a->data;
+    auto d_a_tmp = a_tmp->data;
+    auto d_b = b->data;
+    auto d_b_tmp = b_tmp->data;
+    auto d_c = c->data;
+    auto d_c_tmp = c_tmp->data;
+
+    auto size = Domain::getInstance()->get_size(a->get_level());
+
+    auto boundary = BoundaryController::getInstance();
+
+    size_t *d_bList = boundary->get_boundaryList_level_joined();
+    size_t bsize_b = boundary->getSize_boundaryList();
+    size_t *d_oList = boundary->get_obstacleList();
+    size_t bsize_o = boundary->getSize_obstacleList();
+
+#pragma acc data present(d_a[:size], d_a_tmp[:size], d_b[:size], d_b_tmp[:size], d_c[:size], d_c_tmp[:size], d_bList[:bsize_b], d_oList[:bsize_o])
+    {
+        // boundary
+#pragma omp parallel for
+#pragma acc kernels async
+#pragma acc loop independent
+        for (size_t j = 0; j < bsize_b; ++j) {
+            const size_t i = d_bList[j];
+            d_a[i] = d_a_tmp[i];
+            d_b[i] = d_b_tmp[i];
+            d_c[i] = d_c_tmp[i];
+        }
+        // obstacles
+#pragma omp parallel for
+#pragma acc kernels async
+#pragma acc loop independent
+        for (size_t j = 0; j < bsize_o; ++j) {
+            const size_t i = d_oList[j];
+            d_a[i] = d_a_tmp[i];
+            d_b[i] = d_b_tmp[i];
+            d_c[i] = d_c_tmp[i];
+        }
+
+        if (sync) {
+#pragma acc wait
+        }
+    }//end data region
+}
+
 void FieldController::update_device() {
     auto d_u = field_u->data;
     auto d_v = field_v->data;
@@ -80,6 +80,7 @@ public:
 
     static void couple_vector(const Field *a, Field *a0, Field *a_tmp, const Field *b, Field *b0, Field *b_tmp, const Field *c, Field *c0, Field *c_tmp, bool sync);
     static void couple_scalar(const Field *a, Field *a0, Field *a_tmp, bool sync);
+    static void rotate_vector(Field *a, Field *a_tmp, Field *b, Field *b_tmp, Field *c, Field *c_tmp, bool sync);
 
     void update_device();
     void update_host();
@@ -0,0 +1,216 @@
+/// \file       SeparableFilter.cpp
+/// \brief      Explicit 3x3x3 box filter applied as three one dimensional sweeps
+/// \date       Oct 17, 2026
+/// \author     ARTSS developers
+/// \copyright  <2015-2020> Forschungszentrum Juelich GmbH. All rights reserved.
+
+#include "SeparableFilter.h"
+#include "../Domain.h"
+#include "../boundary/BoundaryController.h"
+
+SeparableFilter::SeparableFilter() : m_w0(1. / 4.), m_w1(1. / 2.), m_w2(1. / 4.) {
+    init();
+}
+
+SeparableFilter::SeparableFilter(real w0, real w1, real w2) : m_w0(w0), m_w1(w1), m_w2(w2) {
+    init();
+}
+
+void SeparableFilter::init() {
+    m_size = Domain::getInstance()->get_size();
+    for (size_t f = 0; f < 3; f++) {
+        m_sweep_z[f] = nullptr;
+        m_sweep_y[f] = nullptr;
+    }
+    // buffers of the first field, further ones are created by the first filter_vector call
+    m_sweep_z[0] = new real[m_size];
+    m_sweep_y[0] = new real[m_size];
+    auto d_sz = m_sweep_z[0];
+    auto d_sy = m_sweep_y[0];
+    size_t bsize = m_size;
+#pragma acc enter data create(d_sz[:bsize], d_sy[:bsize])
+}
+
+SeparableFilter::~SeparableFilter() {
+    size_t bsize = m_size;
+    for (size_t f = 0; f < 3; f++) {
+        auto d_sz = m_sweep_z[f];
+        auto d_sy = m_sweep_y[f];
+        if (d_sz != nullptr) {
+#pragma acc exit data delete(d_sz[:bsize], d_sy[:bsize])
+            delete[] d_sz;
+            delete[] d_sy;
+        }
+    }
+}
+
+//=================================== Filter ============================================
+// ***************************************************************************************
+/// \brief  filters one field
+/// \param  out           output pointer (inner cells)
+/// \param  in            input pointer
+/// \param  sync          synchronization boolean (true=sync (default), false=async)
+// ***************************************************************************************
+template<typename TO, typename TI>
+void SeparableFilter::filter(FieldT<TO> *out, const FieldT<TI> *in, bool sync) {
+    auto domain = Domain::getInstance();
+    const size_t Nx = domain->get_Nx();
+    const size_t Ny = domain->get_Ny();
+    const size_t Nz = domain->get_Nz();
+    const size_t bsize = m_size;
+
+    auto d_out = out->data;
+    auto d_in = in->data;
+    auto d_sz = m_sweep_z[0];
+    auto d_sy = m_sweep_y[0];
+
+    const real w0 = m_w0;
+    const real w1 = m_w1;
+    const real w2 = m_w2;
+
+    auto boundary = BoundaryController::getInstance();
+    size_t *d_iList = boundary->get_innerList_level_joined();
+    auto bsize_i = boundary->getSize_innerList();
+
+    // z sweep (all rows and columns, since the y and x sweeps read ghost rows/columns)
+#pragma omp parallel for collapse(2)
+#pragma acc parallel loop independent collapse(3) present(d_in[:bsize], d_sz[:bsize]) async
+    for (size_t k = 1; k < Nz - 1; k++) {
+        for (size_t j = 0; j < Ny; j++) {
+            for (size_t i = 0; i < Nx; i++) {
+                const size_t idx = IX(i, j, k, Nx, Ny);
+                d_sz[idx] = w0 * d_in[idx - Nx * Ny] + w1 * d_in[idx] + w2 * d_in[idx + Nx * Ny];
+            }
+        }
+    }
+
+    // y sweep
+#pragma omp parallel for collapse(2)
+#pragma acc parallel loop independent collapse(3) present(d_sz[:bsize], d_sy[:bsize]) async
+    for (size_t k = 1; k < Nz - 1; k++) {
+        for (size_t j = 1; j < Ny - 1; j++) {
+            for (size_t i = 0; i < Nx; i++) {
+                const size_t idx = IX(i, j, k, Nx, Ny);
+                d_sy[idx] = w0 * d_sz[idx - Nx] + w1 * d_sz[idx] + w2 * d_sz[idx + Nx];
+            }
+        }
+    }
+
+    // x sweep
+#pragma omp parallel for
+#pragma acc parallel loop independent present(d_sy[:bsize], d_out[:bsize], d_iList[:bsize_i]) async
+    for (size_t l = 0; l < bsize_i; ++l) {
+        const size_t idx = d_iList[l];
+        d_out[idx] = w0 * d_sy[idx - 1] + w1 * d_sy[idx] + w2 * d_sy[idx + 1];
+    }
+
+    if (sync) {
+#pragma acc wait
+    }
+}
+
+//=================================== Filter vector =====================================
+// ***************************************************************************************
+/// \brief  filters three fields (e.g. velocity components) in one traversal per sweep
+/// \param  out_x         output pointer of first field
+/// \param  out_y         output pointer of second field
+/// \param  out_z         output pointer of third field
+/// \param  in_x          input pointer of first field
+/// \param  in_y          input pointer of second field
+/// \param  in_z          input pointer of third field
+/// \param  sync          synchronization boolean (true=sync (default), false=async)
+// ***************************************************************************************
+template<typename TO, typename TI>
+void SeparableFilter::filter_vector(FieldT<TO> *out_x, FieldT<TO> *out_y, FieldT<TO> *out_z,
+                                    const FieldT<TI> *in_x, const FieldT<TI> *in_y, const FieldT<TI> *in_z, bool sync) {
+    auto domain = Domain::getInstance();
+    const size_t Nx = domain->get_Nx();
+    const size_t Ny = domain->get_Ny();
+    const size_t Nz = domain->get_Nz();
+    const size_t bsize = m_size;
+
+    for (size_t f = 1; f < 3; f++) {
+        if (m_sweep_z[f] == nullptr) {
+            m_sweep_z[f] = new real[bsize];
+            m_sweep_y[f] = new real[bsize];
+            auto d_sz = m_sweep_z[f];
+            auto d_sy = m_sweep_y[f];
+#pragma acc enter data create(d_sz[:bsize], d_sy[:bsize])
+        }
+    }
+
+    auto d_out_x = out_x->data;
+    auto d_out_y = out_y->data;
+    auto d_out_z = out_z->data;
+    auto d_in_x = in_x->data;
+    auto d_in_y = in_y->data;
+    auto d_in_z = in_z->data;
+    auto d_sz_x = m_sweep_z[0];
+    auto d_sz_y = m_sweep_z[1];
+    auto d_sz_z = m_sweep_z[2];
+    auto d_sy_x = m_sweep_y[0];
+    auto d_sy_y = m_sweep_y[1];
+    auto d_sy_z = m_sweep_y[2];
+
+    const real w0 = m_w0;
+    const real w1 = m_w1;
+    const real w2 = m_w2;
+
+    auto boundary = BoundaryController::getInstance();
+    size_t *d_iList = boundary->get_innerList_level_joined();
+    auto bsize_i = boundary->getSize_innerList();
+
+    // z sweep
+#pragma omp parallel for collapse(2)
+#pragma acc parallel loop independent collapse(3) present(d_in_x[:bsize], d_in_y[:bsize], d_in_z[:bsize], d_sz_x[:bsize], d_sz_y[:bsize], d_sz_z[:bsize]) async
+    for (size_t k = 1; k < Nz - 1; k++) {
+        for (size_t j = 0; j < Ny; j++) {
+            for (size_t i = 0; i < Nx; i++) {
+                const size_t idx = IX(i, j, k, Nx, Ny);
+                d_sz_x[idx] = w0 * d_in_x[idx - Nx * Ny] + w1 * d_in_x[idx] + w2 * d_in_x[idx + Nx * Ny];
+                d_sz_y[idx] = w0 * d_in_y[idx - Nx * Ny] + w1 * d_in_y[idx] + w2 * d_in_y[idx + Nx * Ny];
+                d_sz_z[idx] = w0 * d_in_z[idx - Nx * Ny] + w1 * d_in_z[idx] + w2 * d_in_z[idx + Nx * Ny];
+            }
+        }
+    }
+
+    // y sweep
+#pragma omp parallel for collapse(2)
+#pragma acc parallel loop independent collapse(3) present(d_sz_x[:bsize], d_sz_y[:bsize], d_sz_z[:bsize], d_sy_x[:bsize], d_sy_y[:bsize], d_sy_z[:bsize]) async
+    for (size_t k = 1; k < Nz - 1; k++) {
+        for (size_t j = 1; j < Ny - 1; j++) {
+            for (size_t i = 0; i < Nx; i++) {
+                const size_t idx = IX(i, j, k, Nx, Ny);
+                d_sy_x[idx] = w0 * d_sz_x[idx - Nx] + w1 * d_sz_x[idx] + w2 * d_sz_x[idx + Nx];
+                d_sy_y[idx] = w0 * d_sz_y[idx - Nx] + w1 * d_sz_y[idx] + w2 * d_sz_y[idx + Nx];
+                d_sy_z[idx] = w0 * d_sz_z[idx - Nx] + w1 * d_sz_z[idx] + w2 * d_sz_z[idx + Nx];
+            }
+        }
+    }
+
+    // x sweep
+#pragma omp parallel for
+#pragma acc parallel loop independent present(d_sy_x[:bsize], d_sy_y[:bsize], d_sy_z[:bsize], d_out_x[:bsize], d_out_y[:bsize], d_out_z[:bsize], d_iList[:bsize_i]) async
+    for (size_t l = 0; l < bsize_i; ++l) {
+        const size_t idx = d_iList[l];
+        d_out_x[idx] = w0 * d_sy_x[idx - 1] + w1 * d_sy_x[idx] + w2 * d_sy_x[idx + 1];
+        d_out_y[idx] = w0 * d_sy_y[idx - 1] + w1 * d_sy_y[idx] + w2 * d_sy_y[idx + 1];
+        d_out_z[idx] = w0 * d_sy_z[idx - 1] + w1 * d_sy_z[idx] + w2 * d_sy_z[idx + 1];
+    }
+
+    if (sync) {
+#pragma acc wait
+    }
+}
+
+template void SeparableFilter::filter<real, real>(Field *out, const Field *in, bool sync);
+template void SeparableFilter::filter_vector<real, real>(Field *out_x, Field *out_y, Field *out_z,
+                                                         const Field *in_x, const Field *in_y, const Field *in_z, bool sync);
+#ifdef MIXED_PRECISION
+template void SeparableFilter::filter<real_lp, real>(FieldLP *out, const Field *in, bool sync);
+template void SeparableFilter::filter<real_lp, real_lp>(FieldLP *out, const FieldLP *in, bool sync);
+template void SeparableFilter::filter_vector<real_lp, real>(FieldLP *out_x, FieldLP *out_y, FieldLP *out_z,
+                                                            const Field *in_x, const Field *in_y, const Field *in_z, bool sync);
+template void SeparableFilter::filter_vector<real_lp, real_lp>(FieldLP *out_x, FieldLP *out_y, FieldLP *out_z,
+                                                               const FieldLP *in_x, const FieldLP *in_y, const FieldLP *in_z, bool sync);
+#endif
@@ -14,6 +14,15 @@ public:
     IAdvection() = default;
     virtual ~IAdvection() = default;
     virtual void advect(Field *out, Field *in, const Field *u_vel, const Field *v_vel, const Field *w_vel, bool sync) = 0;
+
+    /// \brief  advects three fields (e.g. velocity components) with the same velocity,
+    ///         methods without a batched implementation advect them one after another
+    virtual void advect_vector(Field *out_x, Field *out_y, Field *out_z, Field *in_x, Field *in_y, Field *in_z,
+                               const Field *u_vel, const Field *v_vel, const Field *w_vel, bool sync) {
+        advect(out_x, in_x, u_vel, v_vel, w_vel, sync);
+        advect(out_y, in_y, u_vel, v_vel, w_vel, sync);
+        advect(out_z, in_z, u_vel, v_vel, w_vel, sync);
+    }
 };
 
 #endif /* ARTSS_INTERFACES_IADVECTION_H_ */
@@ -50,6 +50,7 @@ void IPressure::divergence(Field *out, const Field *in_x, const Field *in_y, con
 
 #pragma acc data present(d_out[:size], d_inx[:size], d_iny[:size], d_inz[:size], d_iList[:bsize_i], d_bList[:bsize_b])
     {
+#pragma omp parallel for
 #pragma acc kernels async
 #pragma acc loop independent
         for (size_t j = 0; j < bsize_i; ++j) {
@@ -60,6 +61,7 @@ void IPressure::divergence(Field *out, const Field *in_x, const Field *in_y, con
         }
 
 //boundaries
+#pragma omp parallel for
 #pragma acc kernels async
 #pragma acc loop independent
         for (size_t j = 0; j < bsize_b; ++j) {
@@ -124,6 +126,7 @@ void IPressure::projection(Field *out_u, Field *out_v, Field *out_w, const Field
 
 #pragma acc data present(d_outu[:size], d_outv[:size], d_outw[:size], d_inu[:size], d_inv[:size], d_inw[:size], d_inp[:size], d_iList[:bsize_i])
     {
+#pragma omp parallel for
 #pragma acc kernels async
 #pragma acc loop independent
         for (size_t j = 0; j < bsize_i; ++j) {
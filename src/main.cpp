@@ -38,6 +38,16 @@ int main(int argc, char **argv) {
     // Integrate over time and solve numerically
     // Time integration
     TimeIntegration ti(sc);
+    // continue a previous run: --restart <checkpoint file>
+    for (int arg = 2; arg < argc; arg++) {
+        if (std::string(argv[arg]) == "--restart") {
+            if (arg + 1 >= argc) {
+                std::cerr << "checkpoint file missing" << std::endl;
+                std::exit(1);
+            }
+            ti.restart(argv[arg + 1]);
+        }
+    }
     ti.run();
 
     // Clean up
@@ -0,0 +1,322 @@
+/// \file       MGPCGPressure.cpp
+/// \brief      Defines conjugate gradient method preconditioned by a multigrid V-cycle
+/// \date       Oct 16, 2026
+/// \author     ARTSS developers
+/// \copyright  <2015-2020> Forschungszentrum Juelich GmbH. All rights reserved.
+
+#include <cmath>
+#include <iostream>
+
+#include "MGPCGPressure.h"
+#include "../utility/Parameters.h"
+#include "../boundary/BoundaryController.h"
+#include "../Domain.h"
+
+// =============================== Constructor ===============================
+// *****************************************************************************
+/// \brief  Constructor
+/// \param  out     pressure
+/// \param  b       rhs
+// *****************************************************************************
+MGPCGPressure::MGPCGPressure(Field *out, Field *b) {
+#ifndef BENCHMARKING
+    m_logger = Utility::create_logger(typeid(this).name());
+#endif
+    auto params = Parameters::getInstance();
+    auto domain = Domain::getInstance();
+    auto boundary = BoundaryController::getInstance();
+
+    m_max_iter = params->get_int("solver/pressure/max_cycle");
+    m_tol_res = params->get_real("solver/pressure/tol_res");
+
+    // without Dirichlet patch the pressure is defined up to a constant (pure Neumann/ periodic)
+    auto boundary_data = boundary->get_domain_boundary_data(out->get_type());
+    m_singular = true;
+    for (size_t patch = 0; patch < numberOfPatches; ++patch) {
+        if (boundary_data->getBoundaryCondition(static_cast<Patch>(patch)) == BoundaryCondition::DIRICHLET) {
+            m_singular = false;
+        }
+    }
+
+    // multigrid hierarchy (level fields) used as preconditioner
+    m_precond = new VCycleMG(out, b);
+
+    FieldType type = out->get_type();
+    m_residuum = new Field(type, 0.0);
+    m_precond_residuum = new Field(type, 0.0);
+    m_direction = new Field(type, 0.0);
+    m_laplace_direction = new Field(type, 0.0);
+
+    auto d_r = m_residuum->data;
+    auto d_z = m_precond_residuum->data;
+    auto d_d = m_direction->data;
+    auto d_q = m_laplace_direction->data;
+    size_t bsize = domain->get_size();
+
+#pragma acc enter data copyin(d_r[:bsize], d_z[:bsize], d_d[:bsize], d_q[:bsize])
+}
+
+MGPCGPressure::~MGPCGPressure() {
+    auto domain = Domain::getInstance();
+    size_t bsize = domain->get_size();
+
+    auto d_r = m_residuum->data;
+    auto d_z = m_precond_residuum->data;
+    auto d_d = m_direction->data;
+    auto d_q = m_laplace_direction->data;
+
+#pragma acc exit data delete(d_r[:bsize], d_z[:bsize], d_d[:bsize], d_q[:bsize])
+
+    delete m_residuum;
+    delete m_precond_residuum;
+    delete m_direction;
+    delete m_laplace_direction;
+    delete m_precond;
+}
+
+//==================================== Laplace =================================
+// *****************************************************************************
+/// \brief  applies the linear part of the discrete Laplacian \f$ q = \nabla^2 d\f$ (homogeneous
+///         boundary conditions of d are set, i.e. the current boundary values are ignored)
+/// \param  out         Laplacian q
+/// \param  in          direction d (boundary cells overwritten)
+/// \param  dot         scalar product of d and q in inner cells
+/// \param  sync        synchronization boolean (true=sync (default), false=async)
+// *****************************************************************************
+void MGPCGPressure::Laplace(Field *out, Field *in, real &dot, bool sync) {
+    auto domain = Domain::getInstance();
+    auto boundary = BoundaryController::getInstance();
+
+    auto d_out = out->data;
+    auto d_in = in->data;
+
+    const size_t Nx = domain->get_Nx();
+    const size_t Ny = domain->get_Ny();
+    size_t bsize = domain->get_size();
+
+    const real rdx2 = 1. / (domain->get_dx() * domain->get_dx());
+    const real rdy2 = 1. / (domain->get_dy() * domain->get_dy());
+    const real rdz2 = 1. / (domain->get_dz() * domain->get_dz());
+
+    size_t *d_iList = boundary->get_innerList_level_joined();
+    auto bsize_i = boundary->getSize_innerList();
+
+    boundary->applyBoundary(d_in, 0, in->get_type(), sync, true);
+
+    real sum = 0.;
+#pragma omp parallel for reduction(+:sum)
+#pragma acc parallel loop independent present(d_out[:bsize], d_in[:bsize], d_iList[:bsize_i]) reduction(+:sum) async
+    for (size_t j = 0; j < bsize_i; ++j) {
+        const size_t i = d_iList[j];
+        const real q_i = rdx2 * (d_in[i - 1] - 2 * d_in[i] + d_in[i + 1])\
+ + rdy2 * (d_in[i - Nx] - 2 * d_in[i] + d_in[i + Nx])\
+ + rdz2 * (d_in[i - Nx * Ny] - 2 * d_in[i] + d_in[i + Nx * Ny]);
+        d_out[i] = q_i;
+        sum += d_in[i] * q_i;
+    }
+#pragma acc wait
+    dot = sum;
+}
+
+//==================================== Remove mean ==============================
+// *****************************************************************************
+/// \brief  subtracts the mean value in inner cells (projection onto the range of the
+///         Laplacian, if the pressure is defined up to a constant only)
+/// \param  out         field
+/// \param  sync        synchronization boolean (true=sync (default), false=async)
+// *****************************************************************************
+void MGPCGPressure::RemoveMean(Field *out, bool sync) {
+    auto domain = Domain::getInstance();
+    auto boundary = BoundaryController::getInstance();
+
+    auto d_out = out->data;
+    size_t bsize = domain->get_size();
+
+    size_t *d_iList = boundary->get_innerList_level_joined();
+    auto bsize_i = boundary->getSize_innerList();
+
+    real sum = 0.;
+#pragma omp parallel for reduction(+:sum)
+#pragma acc parallel loop independent present(d_out[:bsize], d_iList[:bsize_i]) reduction(+:sum) async
+    for (size_t j = 0; j < bsize_i; ++j) {
+        sum += d_out[d_iList[j]];
+    }
+#pragma acc wait
+    const real mean = sum / static_cast<real>(bsize_i);
+
+#pragma omp parallel for
+#pragma acc parallel loop independent present(d_out[:bsize], d_iList[:bsize_i]) async
+    for (size_t j = 0; j < bsize_i; ++j) {
+        d_out[d_iList[j]] -= mean;
+    }
+
+    if (sync) {
+#pragma acc wait
+    }
+}
+
+//==================================== Pressure =================================
+// *****************************************************************************
+/// \brief  solves Poisson equation \f$ \nabla^2 p = rhs\f$ via conjugate gradient method
+///         preconditioned by one V-cycle, stops if \f$ ||rhs - \nabla^2 p|| < tol\_res\f$
+/// \param  out         pressure
+/// \param  b           rhs
+/// \param  t           current time
+/// \param  sync        synchronization boolean (true=sync (default), false=async)
+// *****************************************************************************
+void MGPCGPressure::pressure(Field *out, Field *b, real t, bool sync) {
+    auto domain = Domain::getInstance();
+    auto boundary = BoundaryController::getInstance();
+
+    auto d_out = out->data;
+    auto d_b = b->data;
+    auto d_r = m_residuum->data;
+    auto d_z = m_precond_residuum->data;
+    auto d_d = m_direction->data;
+    auto d_q = m_laplace_direction->data;
+
+    const size_t Nx = domain->get_Nx();
+    const size_t Ny = domain->get_Ny();
+    size_t bsize = domain->get_size();
+
+    const real rdx2 = 1. / (domain->get_dx() * domain->get_dx());
+    const real rdy2 = 1. / (domain->get_dy() * domain->get_dy());
+    const real rdz2 = 1. / (domain->get_dz() * domain->get_dz());
+
+    size_t *d_iList = boundary->get_innerList_level_joined();
+    auto bsize_i = boundary->getSize_innerList();
+
+    FieldType type = out->get_type();
+
+#pragma acc data present(d_out[:bsize], d_b[:bsize], d_r[:bsize], d_z[:bsize], d_d[:bsize], d_q[:bsize], d_iList[:bsize_i])
+    {
+        boundary->applyBoundary(d_out, type, sync);
+
+        // r = b - Laplace(p)
+        real sum = 0.;
+#pragma omp parallel for reduction(+:sum)
+#pragma acc parallel loop independent present(d_out[:bsize], d_b[:bsize], d_r[:bsize], d_iList[:bsize_i]) reduction(+:sum) async
+        for (size_t j = 0; j < bsize_i; ++j) {
+            const size_t i = d_iList[j];
+            const real r_i = d_b[i] - (rdx2 * (d_out[i - 1] - 2 * d_out[i] + d_out[i + 1])\
+ + rdy2 * (d_out[i - Nx] - 2 * d_out[i] + d_out[i + Nx])\
+ + rdz2 * (d_out[i - Nx * Ny] - 2 * d_out[i] + d_out[i + Nx * Ny]));
+            d_r[i] = r_i;
+            sum += r_i * r_i;
+        }
+#pragma acc wait
+        real res = sqrt(sum);
+
+        if (m_singular) {
+            // only the compatible part of the rhs can be reduced
+            RemoveMean(m_residuum, sync);
+
+            sum = 0.;
+#pragma omp parallel for reduction(+:sum)
+#pragma acc parallel loop independent present(d_r[:bsize], d_iList[:bsize_i]) reduction(+:sum) async
+            for (size_t j = 0; j < bsize_i; ++j) {
+                const size_t i = d_iList[j];
+                sum += d_r[i] * d_r[i];
+            }
+#pragma acc wait
+            res = sqrt(sum);
+        }
+
+        int it = 0;
+        if (res > m_tol_res) {
+            // z = M^-1 r, d = z
+            m_precond->Precondition(m_precond_residuum, m_residuum, sync);
+            if (m_singular) {
+                RemoveMean(m_precond_residuum, sync);
+            }
+
+            real rz = 0.;
+#pragma omp parallel for reduction(+:rz)
+#pragma acc parallel loop independent present(d_r[:bsize], d_z[:bsize], d_d[:bsize], d_iList[:bsize_i]) reduction(+:rz) async
+            for (size_t j = 0; j < bsize_i; ++j) {
+                const size_t i = d_iList[j];
+                d_d[i] = d_z[i];
+                rz += d_r[i] * d_z[i];
+            }
+#pragma acc wait
+
+            while (res > m_tol_res && it < m_max_iter) {
+                // q = Laplace(d), alpha = (r, z)/(d, q)
+                real dq = 0.;
+                Laplace(m_laplace_direction, m_direction, dq, sync);
+                const real alpha = rz / dq;
+
+                // p = p + alpha d, r = r - alpha q (residuum and (r, z_old) in the same sweep)
+                real rr = 0.;
+                real rz_old = 0.;
+#pragma omp parallel for reduction(+:rr, rz_old)
+#pragma acc parallel loop independent present(d_out[:bsize], d_r[:bsize], d_z[:bsize], d_d[:bsize], d_q[:bsize], d_iList[:bsize_i]) reduction(+:rr, rz_old) async
+                for (size_t j = 0; j < bsize_i; ++j) {
+                    const size_t i = d_iList[j];
+                    d_out[i] += alpha * d_d[i];
+                    const real r_i = d_r[i] - alpha * d_q[i];
+                    d_r[i] = r_i;
+                    rr += r_i * r_i;
+                    rz_old += r_i * d_z[i];
+                }
+#pragma acc wait
+                res = sqrt(rr);
+                it++;
+
+                if (res <= m_tol_res) {
+                    break;
+                }
+
+                m_precond->Precondition(m_precond_residuum, m_residuum, sync);
+                if (m_singular) {
+                    RemoveMean(m_precond_residuum, sync);
+                }
+
+                real rz_new = 0.;
+#pragma omp parallel for reduction(+:rz_new)
+#pragma acc parallel loop independent present(d_r[:bsize], d_z[:bsize], d_iList[:bsize_i]) reduction(+:rz_new) async
+                for (size_t j = 0; j < bsize_i; ++j) {
+                    const size_t i = d_iList[j];
+                    rz_new += d_r[i] * d_z[i];
+                }
+#pragma acc wait
+
+                // preconditioned residuum is no descent direction anymore, remaining residuum is
+                // not in the range of the operator (e.g. inconsistent rhs at obstacle edges)
+                if (rz_new * rz <= 0.) {
+#ifndef BENCHMARKING
+                    m_logger->warn("MGPCG breakdown after {} iterations, (r, z) = {:0.5e}", it, rz_new);
+#else
+                    std::cout << "MGPCG breakdown after " << it << " iterations" << std::endl;
+#endif
+                    break;
+                }
+
+                // flexible (Polak-Ribiere) update, since the V-cycle is not exactly symmetric
+                const real beta = (rz_new - rz_old) / rz;
+                rz = rz_new;
+
+#pragma omp parallel for
+#pragma acc parallel loop independent present(d_z[:bsize], d_d[:bsize], d_iList[:bsize_i]) async
+                for (size_t j = 0; j < bsize_i; ++j) {
+                    const size_t i = d_iList[j];
+                    d_d[i] = d_z[i] + beta * d_d[i];
+                }
+            }
+        }
+
+        boundary->applyBoundary(d_out, type, sync);
+
+        if (sync) {
+#pragma acc wait
+        }
+
+#ifndef BENCHMARKING
+        m_logger->info("Number of iterations: {}", it);
+        m_logger->info("MGPCG ||res|| = {:0.5e}", res);
+        if (res > m_tol_res) {
+            m_logger->warn("MGPCG did not converge, ||res|| = {:0.5e} > tol_res = {}", res, m_tol_res);
+        }
+#endif
+    }  // end data region
+}
@@ -0,0 +1,42 @@
+/// \file       MGPCGPressure.h
+/// \brief      Defines conjugate gradient method preconditioned by a multigrid V-cycle
+/// \date       Oct 16, 2026
+/// \author     ARTSS developers
+/// \copyright  <2015-2020> Forschungszentrum Juelich GmbH. All rights reserved.
+
+#ifndef ARTSS_PRESSURE_MGPCGPRESSURE_H_
+#define ARTSS_PRESSURE_MGPCGPRESSURE_H_
+
+#include "../interfaces/IPressure.h"
+#include "../field/Field.h"
+#include "../utility/GlobalMacrosTypes.h"
+#include "../utility/Utility.h"
+#include "VCycleMG.h"
+
+class MGPCGPressure: public IPressure{
+public:
+    MGPCGPressure(Field* out, Field* b);
+    ~MGPCGPressure() override;
+
+    void pressure(Field* out, Field* b, real t, bool sync);
+
+private:
+    void Laplace(Field* out, Field* in, real &dot, bool sync = true);
+    void RemoveMean(Field* out, bool sync = true);
+
+    VCycleMG* m_precond;
+
+    int m_max_iter;
+    real m_tol_res;
+    bool m_singular;
+
+    Field* m_residuum;
+    Field* m_precond_residuum;
+    Field* m_direction;
+    Field* m_laplace_direction;
+#ifndef BENCHMARKING
+    std::shared_ptr<spdlog::logger> m_logger;
+#endif
+};
+
+#endif /* ARTSS_PRESSURE_MGPCGPRESSURE_H_ */
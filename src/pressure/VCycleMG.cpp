@@ -5,6 +5,7 @@
 /// \copyright  <2015-2020> Forschungszentrum Juelich GmbH. All rights reserved.
 
 #include <cmath>
+#include <type_traits>
 
 #include "VCycleMG.h"
 #include "../diffusion/JacobiDiffuse.h"
@@ -14,6 +15,8 @@
 #include "../Domain.h"
 #include "../solver/SolverSelection.h"
 #include "../utility/Utility.h"
+#include "../boundaryCondition/DomainBoundary.h"
+#include "../visualisation/Visual.h"
 
 
 // =============================== Constructor ===============================
@@ -38,6 +41,65 @@ VCycleMG::VCycleMG(Field *out, Field *b) {
     m_w = 2. / 3.;
     m_w = params->get_real("solver/pressure/diffusion/w");
 
+    // compute residuum while restricting instead of storing it in residuum0 (optional, default: No)
+    m_fused_restriction = (params->get("solver/pressure/fused_restriction/enabled", "No") == "Yes");
+
+    // stop V-cycles after time step 1 as soon as ||res|| < tol_res, at most max_cycle cycles
+    // (optional, default: n_cycle cycles). Residuum is taken from the first restriction of a cycle
+    m_adaptive_cycles = (params->get("solver/pressure/adaptive_cycles/enabled", "No") == "Yes") && levels > 0;
+    m_max_cycles = cycles;
+    m_tol_res = 0.;
+    if (m_adaptive_cycles) {
+        m_max_cycles = params->get_int("solver/pressure/max_cycle");
+        m_tol_res = params->get_real("solver/pressure/tol_res");
+        if (params->get("solver/pressure/adaptive_cycles/save_csv", "No") == "Yes") {
+            m_cycles_csv.open(Visual::remove_extension(params->get_filename()) + "_pressure_cycles.csv", std::ofstream::out);
+            m_cycles_csv << "t,cycles,residuum" << std::endl;
+        }
+    }
+
+    // temporally blocked Jacobi smoother on finest level, requires ghost cells which depend on
+    // the same z-plane only (no obstacles/ surfaces, no periodic front/back)
+    auto boundary = BoundaryController::getInstance();
+    BoundaryData *boundary_data = boundary->get_domain_boundary_data(out->get_type());
+    m_wavefront_smooth = params->get("solver/pressure/diffusion/type") == DiffusionMethods::Jacobi \
+                         && !boundary->hasObstacles() && !boundary->hasSurfaces() && !boundary_data->isEmpty() \
+                         && boundary_data->getBoundaryCondition(Patch::FRONT) != BoundaryCondition::PERIODIC \
+                         && boundary_data->getBoundaryCondition(Patch::BACK) != BoundaryCondition::PERIODIC;
+    for (size_t patch = 0; patch < numberOfPatches && m_wavefront_smooth; ++patch) {
+        long int offset;
+        real sign;
+        real value;
+        m_wavefront_smooth = DomainBoundary::get_ghost_rule(static_cast<Patch>(patch), 0, boundary_data, offset, sign, value);
+    }
+#ifdef _OPENACC
+    m_wavefront_smooth = false;  // plane pipeline is a host (cache) optimization
+#endif
+
+    // colored Gauss-Seidel smoother as two color sweeps over rows (optional, default: No)
+    m_row_split = (params->get("solver/pressure/diffusion/row_split/enabled", "No") == "Yes");
+
+    // cycle type V, W or F (optional, default: V)
+    std::string cycle_type = params->get("solver/pressure/cycle_type", "V");
+    cycle_type.erase(0, cycle_type.find_first_not_of(" \t\n"));
+    cycle_type.erase(cycle_type.find_last_not_of(" \t\n") + 1);
+    if (cycle_type == "V") {
+        m_cycle_type = V_CYCLE;
+    } else if (cycle_type == "W") {
+        m_cycle_type = W_CYCLE;
+    } else if (cycle_type == "F") {
+        m_cycle_type = F_CYCLE;
+    } else {
+#ifndef BENCHMARKING
+        m_logger->error("Cycle type {} not yet implemented! Simulation stopped!", cycle_type);
+#endif
+        std::exit(1);
+    }
+
+    // full multigrid start in first time step and whenever the domain changed (optional, default: No)
+    m_full_multigrid = (params->get("solver/pressure/full_multigrid/enabled", "No") == "Yes") && levels > 1;
+    m_inner_size = boundary->getSize_innerList();
+
     // copies of out and b to prevent aliasing
     auto d_out = out->data;
     auto s_out = domain->get_size(out->get_level());
@@ -46,55 +108,51 @@ VCycleMG::VCycleMG(Field *out, Field *b) {
     auto s_b = domain->get_size(b->get_level());
     auto t_b = b->get_type();
 
-    Field *out_err1 = new Field(t_out, 0.0);
-    Field *out_tmp = new Field(t_out, 0.0);
-    Field *b_res1 = new Field(t_b, 0.0);
+    m_tmp0 = new Field(t_out, 0.0);
+    m_b0 = new Field(t_b, 0.0);
 
     for (size_t i = 0; i < s_out; ++i) {
-        out_err1->data[i] = d_out[i];
-        out_tmp->data[i] = d_out[i];
+        m_tmp0->data[i] = d_out[i];
     }
     for (size_t i = 0; i < s_b; ++i) {
-        b_res1->data[i] = d_b[i];
+        m_b0->data[i] = d_b[i];
     }
 
 // residuum
-    residuum1.push_back(b_res1);
-    auto data_residuum1 = residuum1.back()->data;
-    size_t bsize_residuum1 = domain->get_size(residuum1.back()->get_level());
+    auto data_b0 = m_b0->data;
 
-#pragma acc enter data copyin(data_residuum1[:bsize_residuum1])
-
-// error
-    error1.push_back(out_err1);
-    auto data_err1 = error1.back()->data;
-    size_t bsize_err1 = domain->get_size(error1.back()->get_level());
-
-#pragma acc enter data copyin(data_err1[:bsize_err1])
+#pragma acc enter data copyin(data_b0[:s_b])
 
 // temporal solution
-    mg_temporal_solution.push_back(out_tmp);
-    auto data_mg_temporal_solution = mg_temporal_solution.back()->data;
-    size_t bsize_mg_temporal_solution = domain->get_size(mg_temporal_solution.back()->get_level());
+    auto data_tmp0 = m_tmp0->data;
 
-#pragma acc enter data copyin(data_mg_temporal_solution[:bsize_mg_temporal_solution])
+#pragma acc enter data copyin(data_tmp0[:s_out])
+
+    // level 0 of residuum1, error1 and mg_temporal_solution are m_b0, out and m_tmp0 (full precision)
+    residuum1.push_back(nullptr);
+    error1.push_back(nullptr);
+    mg_temporal_solution.push_back(nullptr);
 
 
     //building Fields for level + sending to GPU
     // levels going up
     for (int i = 0; i < levels; ++i) {
 
-        // build residuum0
-        Field *r0 = new Field(FieldType::P, 0.0, i);
-        residuum0.push_back(r0);
+        // build residuum0 (not needed, if the residuum is computed while restricting)
+        if (m_fused_restriction) {
+            residuum0.push_back(nullptr);
+        } else {
+            FieldLP *r0 = new FieldLP(FieldType::P, 0.0, i);
+            residuum0.push_back(r0);
 
-        auto data_residuum0 = r0->data;
-        size_t bsize_residuum0 = domain->get_size(r0->get_level());
+            auto data_residuum0 = r0->data;
+            size_t bsize_residuum0 = domain->get_size(r0->get_level());
 
 #pragma acc enter data copyin(data_residuum0[:bsize_residuum0])
+        }
 
         // build residuum1
-        Field *r1 = new Field(FieldType::P, 0.0, i + 1);
+        FieldLP *r1 = new FieldLP(FieldType::P, 0.0, i + 1);
         residuum1.push_back(r1);
 
         auto data_residuum1 = r1->data;
@@ -103,7 +161,7 @@ VCycleMG::VCycleMG(Field *out, Field *b) {
 #pragma acc enter data copyin(data_residuum1[:bsize_residuum1])
 
         //  build error1
-        Field *e1 = new Field(FieldType::P, 0.0, i + 1);
+        FieldLP *e1 = new FieldLP(FieldType::P, 0.0, i + 1);
         error1.push_back(e1);
 
         auto d_err1 = e1->data;
@@ -112,7 +170,7 @@ VCycleMG::VCycleMG(Field *out, Field *b) {
 #pragma acc enter data copyin(d_err1[:bsize_err1])
 
         // build mg_temporal_solution
-        Field *mg = new Field(FieldType::P, 0.0, i + 1); //new field to prevent aliasing
+        FieldLP *mg = new FieldLP(FieldType::P, 0.0, i + 1); //new field to prevent aliasing
         mg_temporal_solution.push_back(mg);
 
         auto data_mg_temporal_solution = mg->data;
@@ -124,7 +182,7 @@ VCycleMG::VCycleMG(Field *out, Field *b) {
 //  build err0
     err0.resize(levels + 1);
 
-    Field *e00 = new Field(FieldType::P, 0.0, error1[0]->get_level());
+    FieldLP *e00 = new FieldLP(FieldType::P, 0.0, 0);
 
     err0[0] = e00;
 
@@ -137,7 +195,7 @@ VCycleMG::VCycleMG(Field *out, Field *b) {
     // levels going down
     for (int i=levels; i>0; --i) {
         // build err0
-        Field *e0 = new Field(FieldType::P, 0.0, error1[i - 1]->get_level());
+        FieldLP *e0 = new FieldLP(FieldType::P, 0.0, i - 1);
 
         err0[i] = e0;
 
@@ -153,14 +211,15 @@ VCycleMG::~VCycleMG() {
 
     while (residuum0.size() > 0) {
         auto field = residuum0.back();
-        auto data = residuum0.back()->data;
-        size_t bsize = domain->get_size(residuum0.back()->get_level());
+        if (field != nullptr) {
+            auto data = field->data;
+            size_t bsize = domain->get_size(field->get_level());
 #pragma acc exit data delete(data[:bsize])
-        delete field;
-        field = nullptr;
+            delete field;
+        }
         residuum0.pop_back();
     }
-    while (residuum1.size() > 0) {
+    while (residuum1.size() > 1) {
         auto field = residuum1.back();
         auto data = residuum1.back()->data;
         size_t bsize = domain->get_size(residuum1.back()->get_level());
@@ -178,7 +237,7 @@ VCycleMG::~VCycleMG() {
         field = nullptr;
         err0.pop_back();
     }
-    while (error1.size() > 0) {
+    while (error1.size() > 1) {
         auto field = error1.back();
         auto data = error1.back()->data;
         size_t bsize = domain->get_size(error1.back()->get_level());
@@ -187,7 +246,7 @@ VCycleMG::~VCycleMG() {
         field = nullptr;
         error1.pop_back();
     }
-    while (mg_temporal_solution.size() > 0) {
+    while (mg_temporal_solution.size() > 1) {
         auto field = mg_temporal_solution.back();
         auto data = mg_temporal_solution.back()->data;
         size_t bsize = domain->get_size(mg_temporal_solution.back()->get_level());
@@ -196,6 +255,14 @@ VCycleMG::~VCycleMG() {
         field = nullptr;
         mg_temporal_solution.pop_back();
     }
+
+    // finest level
+    auto data_b0 = m_b0->data;
+    auto data_tmp0 = m_tmp0->data;
+    size_t bsize = domain->get_size();
+#pragma acc exit data delete(data_b0[:bsize], data_tmp0[:bsize])
+    delete m_b0;
+    delete m_tmp0;
 }
 
 // =============================== Update ===============================
@@ -213,32 +280,22 @@ void VCycleMG::UpdateInput(Field *out, Field *b, bool sync) {
     auto d_b = b->data;
     auto s_b = domain->get_size(b->get_level());
 
-    auto f_err1 = error1[0];
-    auto f_mg_tmp = mg_temporal_solution[0];
-    auto f_res1 = residuum1[0];
-
-    auto d_err1 = error1[0]->data;
-    auto d_mg_tmp = mg_temporal_solution[0]->data;
-    auto d_res1 = residuum1[0]->data;
-
-    auto s_err1 = domain->get_size(error1[0]->get_level());
-    auto s_mg_tmp = domain->get_size(mg_temporal_solution[0]->get_level());
-    auto s_res1 = domain->get_size(residuum1[0]->get_level());
+    auto d_mg_tmp = m_tmp0->data;
+    auto d_b0 = m_b0->data;
 
     auto boundary = BoundaryController::getInstance();
     size_t *d_iList = boundary->get_innerList_level_joined();
     auto bsize_i = boundary->getSize_innerList();
 
     // use iList on level 0, since update on level 0
-#pragma acc kernels present(d_out[:s_out], d_b[:s_b], d_err1[:s_err1], \
-                            d_mg_tmp[:s_mg_tmp], d_res1[:s_res1], d_iList[:bsize_i]) async
+#pragma acc kernels present(d_out[:s_out], d_b[:s_b], d_mg_tmp[:s_out], d_b0[:s_b], d_iList[:bsize_i]) async
     {
+#pragma omp parallel for
 #pragma acc loop independent
         for (size_t j = 0; j < bsize_i; ++j) {
             const size_t i = d_iList[j];
-            d_err1[i] = d_out[i];
             d_mg_tmp[i] = d_out[i];
-            d_res1[i] = d_b[i];
+            d_b0[i] = d_b[i];
         }
         if (sync) {
 #pragma acc wait
@@ -269,6 +326,15 @@ void VCycleMG::pressure(Field *out, Field *b, real t, bool sync) {
 
     int act_cycles = 0;
 
+    // initial guess by full multigrid, if there is no reasonable one (first time step, changed domain)
+    if (m_full_multigrid) {
+        const size_t inner_size = BoundaryController::getInstance()->getSize_innerList();
+        if (Nt == 1 || inner_size != m_inner_size) {
+            FullMultigrid(out, sync);
+        }
+        m_inner_size = inner_size;
+    }
+
     if (Nt == 1) {
         const int max_cycles = params->get_int("solver/pressure/max_cycle");
         const int max_relaxs = params->get_int("solver/pressure/diffusion/max_solve");
@@ -306,13 +372,14 @@ void VCycleMG::pressure(Field *out, Field *b, real t, bool sync) {
             sum = 0.;
 
             // calculate residuum in inner cells
-#pragma acc parallel loop independent present(d_out[:bsize], d_b[:bsize], d_iList[:bsize_i]) async
+#pragma omp parallel for reduction(+:sum)
+#pragma acc parallel loop independent present(d_out[:bsize], d_b[:bsize], d_iList[:bsize_i]) reduction(+:sum) async
             for (size_t j = 0; j < bsize_i; ++j) {
                 const size_t i = d_iList[j];
-                r = d_b[i] - (rdx2 * (d_out[i - 1] - 2 * d_out[i] + d_out[i + 1])\
+                const real r_i = d_b[i] - (rdx2 * (d_out[i - 1] - 2 * d_out[i] + d_out[i + 1])\
  + rdy2 * (d_out[i - Nx] - 2 * d_out[i] + d_out[i + Nx])\
  + rdz2 * (d_out[i - Nx * Ny] - 2 * d_out[i] + d_out[i + Nx * Ny]));
-                sum += r * r;
+                sum += r_i * r_i;
             }
 
 #pragma acc wait
@@ -325,11 +392,186 @@ void VCycleMG::pressure(Field *out, Field *b, real t, bool sync) {
         cycles = set_cycles;
         relaxs = set_relaxs;
 
-        for (size_t i = 0; i < cycles; i++)
-            VCycleMultigrid(out, sync);
+        if (m_adaptive_cycles) {
+            real r = 0.;
+            while (act_cycles < m_max_cycles) {
+                VCycleMultigrid(out, sync, &r);
+                act_cycles++;
+                if (r < m_tol_res) {
+                    break;
+                }
+            }
+#ifndef BENCHMARKING
+            m_logger->info("Number of cycles: {}", act_cycles);
+            m_logger->info("VCycle ||res|| = {:0.5e}", r);
+#endif
+            if (m_cycles_csv.is_open()) {
+                m_cycles_csv << t << "," << act_cycles << "," << r << std::endl;
+            }
+        } else {
+            for (size_t i = 0; i < cycles; i++)
+                VCycleMultigrid(out, sync);
+        }
+    }
+
+    if (sync) {
+#pragma acc wait
+    }
+}
+
+//==================================== Precondition ===========================
+// *****************************************************************************
+/// \brief  applies one V-cycle to \f$ \nabla^2 z = b\f$ starting from zero (preconditioner
+///         for Krylov methods), uses the level fields of this multigrid hierarchy. z is a
+///         correction, hence homogeneous boundary conditions are applied on all levels (the
+///         preconditioner has to be linear)
+/// \param  out         approximate solution z (level 0)
+/// \param  b           rhs (level 0)
+/// \param  sync        synchronization boolean (true=sync (default), false=async)
+// *****************************************************************************
+void VCycleMG::Precondition(Field *out, Field *b, bool sync) {
+    auto domain = Domain::getInstance();
+    auto d_out = out->data;
+    size_t bsize = domain->get_size(out->get_level());
 
+    // zero initial guess (inner, boundary and obstacle cells)
+#pragma omp parallel for
+#pragma acc parallel loop independent present(d_out[:bsize]) async
+    for (size_t i = 0; i < bsize; ++i) {
+        d_out[i] = 0.;
     }
 
+    UpdateInput(out, b, sync);
+    m_homogeneous = true;
+    VCycleMultigrid(out, sync);
+    m_homogeneous = false;
+
+    if (sync) {
+#pragma acc wait
+    }
+}
+
+//==================================== Apply boundary ==========================
+// *****************************************************************************
+/// \brief  applies the boundary conditions of the given level, homogeneous ones on all
+///         levels while preconditioning
+/// \param  d           data field
+/// \param  level       Multigrid level
+/// \param  type        type of field
+/// \param  sync        synchronization boolean (true=sync (default), false=async)
+// *****************************************************************************
+template<typename T>
+void VCycleMG::ApplyBoundary(T *d, size_t level, FieldType type, bool sync) {
+    BoundaryController::getInstance()->applyBoundary(d, level, type, sync, m_homogeneous);
+}
+
+//==================================== Full Multigrid ==========================
+// *****************************************************************************
+/// \brief  Full Multigrid start: restricts rhs to coarsest solve level, solves there and
+///         interpolates the solution level by level to the finest grid, conducting one cycle on
+///         each intermediate level. Overwrites out with the interpolated initial guess
+/// \param  out         pressure
+/// \param  sync        synchronization boolean (true=sync (default), false=async)
+// *****************************************************************************
+void VCycleMG::FullMultigrid(Field *out, bool sync) {
+    auto domain = Domain::getInstance();
+    auto boundary = BoundaryController::getInstance();
+    size_t *d_iList = boundary->get_innerList_level_joined();
+    size_t *d_bList = boundary->get_boundaryList_level_joined();
+
+    const size_t c = static_cast<size_t>(levels) - 1; // solve level
+
+    // restrict rhs to solve level
+    for (size_t i = 0; i < c; ++i) {
+        auto d_res1ip = residuum1[i + 1]->data;
+        auto s_res1ip = domain->get_size(residuum1[i + 1]->get_level());
+        FieldType type_r1 = residuum1[i + 1]->get_type();
+
+#pragma acc data present(d_res1ip[:s_res1ip])
+        {
+            if (i == 0) {
+                Restrict(residuum1[i + 1], m_b0, i, sync);
+            } else {
+                Restrict(residuum1[i + 1], residuum1[i], i, sync);
+            }
+            ApplyBoundary(d_res1ip, i + 1, type_r1, sync); // for res only Dirichlet BC
+        }
+    }
+
+    // solve on coarsest level starting from zero
+    {
+        auto d_err1c = error1[c]->data;
+        auto d_mg_tmpc = mg_temporal_solution[c]->data;
+        auto d_res1c = residuum1[c]->data;
+        auto s_err1c = domain->get_size(error1[c]->get_level());
+        auto s_mg_tmpc = domain->get_size(mg_temporal_solution[c]->get_level());
+        auto s_res1c = domain->get_size(residuum1[c]->get_level());
+
+        // inner start/ end index of level c
+        size_t start_i = boundary->get_innerList_level_joined_start(c);
+        size_t end_i = boundary->get_innerList_level_joined_end(c) + 1;
+        // boundary start/ end index of level c
+        size_t start_b = boundary->get_boundaryList_level_joined_start(c);
+        size_t end_b = boundary->get_boundaryList_level_joined_end(c) + 1;
+
+#pragma acc data present(d_err1c[:s_err1c], d_mg_tmpc[:s_mg_tmpc], d_res1c[:s_res1c])
+        {
+            // inner
+#pragma omp parallel for
+#pragma acc kernels present(d_err1c[:s_err1c], d_iList[start_i:(end_i-start_i)]) async
+#pragma acc loop independent
+            for (size_t j = start_i; j < end_i; ++j) {
+                const size_t idx = d_iList[j];
+                d_err1c[idx] = 0.0;
+            }
+
+            //boundary
+#pragma omp parallel for
+#pragma acc kernels present(d_err1c[:s_err1c], d_bList[start_b:(end_b-start_b)]) async
+#pragma acc loop independent
+            for (size_t j = start_b; j < end_b; ++j) {
+                const size_t idx = d_bList[j];
+                d_err1c[idx] = 0.0;
+            }
+
+            Solve(error1[c], mg_temporal_solution[c], residuum1[c], c, sync);
+        }
+    }
+
+    // interpolate to next finer level and improve by one cycle there
+    for (size_t i = c; i > 0; --i) {
+        auto d_err0i = err0[i]->data;
+        auto d_err1i = error1[i]->data;
+        auto s_err0i = domain->get_size(err0[i]->get_level());
+        auto s_err1i = domain->get_size(error1[i]->get_level());
+
+        FieldType type_e0 = err0[i]->get_type();
+
+#pragma acc data present(d_err0i[:s_err0i], d_err1i[:s_err1i])
+        {
+            // prolongate
+            Prolongate(err0[i], error1[i], i, sync);
+            ApplyBoundary(d_err0i, i - 1, type_e0, sync); // for err0 only Dirichlet BC
+
+            // use p=out on finest grid
+            if (i - 1 == 0) {
+                Correct(out, err0[i], i - 1, true, sync);
+            } else {
+                Correct(error1[i - 1], err0[i], i - 1, true, sync);
+            }
+        } //end data region
+
+        if (i - 1 > 0) {
+            Cycle(out, i - 1, m_cycle_type, sync);
+        }
+    }
+
+    // set boundaries
+    auto d_out = out->data;
+    FieldType type = out->get_type();
+
+    ApplyBoundary(d_out, 0, type, sync);
+
     if (sync) {
 #pragma acc wait
     }
@@ -337,222 +579,299 @@ void VCycleMG::pressure(Field *out, Field *b, real t, bool sync) {
 
 //==================================== VCycle =================================
 // *****************************************************************************
-/// \brief  Conducts the V-cycle Multigrid method
+/// \brief  Conducts one cycle of the Multigrid method (V-, W- or F-cycle, see cycle_type)
 /// \param  out         pressure
 /// \param  sync        synchronization boolean (true=sync (default), false=async)
+/// \param  res_norm    if set, ||res|| on finest grid after pre-smoothing; the cycle stops there,
+///                     if it is below tol_res (coarse grid correction not necessary)
 // *****************************************************************************
-void VCycleMG::VCycleMultigrid(Field *out, bool sync) {
+void VCycleMG::VCycleMultigrid(Field *out, bool sync, real *res_norm) {
     int max_level = levels;
 
     auto domain = Domain::getInstance();
     auto boundary = BoundaryController::getInstance();
-    size_t *d_iList = boundary->get_innerList_level_joined();
-    size_t *d_bList = boundary->get_boundaryList_level_joined();
 
 //===================== No refinement, when levels=0 =========//
     if (max_level == 0) {
-        auto f_mg_tmpi = mg_temporal_solution[0];
-        auto f_res1i = residuum1[0];
-        auto d_mg_tmpi = mg_temporal_solution[0]->data;
-        auto d_res1i = residuum1[0]->data;
+        auto d_mg_tmp = m_tmp0->data;
+        auto d_b0 = m_b0->data;
         auto d_out = out->data;
-        auto s_mg_tmpi = domain->get_size(mg_temporal_solution[0]->get_level());
-        auto s_res1i = domain->get_size(residuum1[0]->get_level());
         auto s_out = domain->get_size();
 
-#pragma acc data present(d_out[:s_out], d_mg_tmpi[:s_mg_tmpi], d_res1i[:s_res1i])
+#pragma acc data present(d_out[:s_out], d_mg_tmp[:s_out], d_b0[:s_out])
         {
-            Solve(out, f_mg_tmpi, f_res1i, max_level, sync);
+            Solve(out, m_tmp0, m_b0, max_level, sync);
         }
         return;
     } //end if
 
-//===================== levels going down ====================//
-    for (int i=0; i<max_level; ++i) {
-        auto f_res0i = residuum0[i];
-        auto f_err1i = error1[i];
-        auto f_err1ip = error1[i + 1];
-        auto f_mg_tmpi = mg_temporal_solution[i];
-        auto f_res1i = residuum1[i];
-        auto f_res1ip = residuum1[i + 1];
+//===================== levels 0 to levels - 1 ===============//
+    Cycle(out, 0, m_cycle_type, sync, res_norm);
 
-        auto d_res0i = residuum0[i]->data;
-        auto d_err1i = error1[i]->data;
-        auto d_err1ip = error1[i + 1]->data;
-        auto d_mg_tmpi = mg_temporal_solution[i]->data;
-        auto d_res1i = residuum1[i]->data;
-        auto d_res1ip = residuum1[i + 1]->data;
-        auto d_out = out->data;
+    // set boundaries
 
-        auto s_res0i = domain->get_size(residuum0[i]->get_level());
-        auto s_err1i = domain->get_size(error1[i]->get_level());
-        auto s_err1ip = domain->get_size(error1[i + 1]->get_level());
-        auto s_mg_tmpi = domain->get_size(mg_temporal_solution[i]->get_level());
-        auto s_res1i = domain->get_size(residuum1[i]->get_level());
-        auto s_res1ip = domain->get_size(residuum1[i + 1]->get_level());
-        auto s_out = domain->get_size(out->get_level());
+    auto d_out = out->data;
+    FieldType type = out->get_type();
 
-        FieldType type_r0 = f_res0i->get_type();
+    ApplyBoundary(d_out, 0, type, sync);
 
-        FieldType type_r1 = residuum1[i + 1]->get_type();
+    if (sync) {
+#pragma acc wait
+    }
+}
 
-        //auto bsize_i = boundary->get_MGiList_Size(i+1);
-        //auto bsize_b = boundary->get_MGbList_Size(i+1);
+//==================================== Cycle ==================================
+// *****************************************************************************
+/// \brief  Conducts one cycle starting at given level (recursively): pre-smoothing,
+///         restriction of residuum, coarse grid correction (V: once, W: twice, F: F- followed
+///         by V-cycle), prolongation and post-smoothing (coarse grid solve at levels - 1)
+/// \param  out         pressure (solution on level 0, else error1[level] is used)
+/// \param  level       Multigrid level
+/// \param  type        cycle type
+/// \param  sync        synchronization boolean (true=sync (default), false=async)
+/// \param  res_norm    if set, ||res|| on this level after pre-smoothing; the cycle stops there,
+///                     if it is below tol_res (coarse grid correction not necessary)
+// *****************************************************************************
+void VCycleMG::Cycle(Field *out, size_t level, CycleType type, bool sync, real *res_norm) {
+    // use p=out on finest grid
+    if (level == 0) {
+        CycleDown(out, m_tmp0, m_b0, level, sync, res_norm);
+    } else {
+        CycleDown(error1[level], mg_temporal_solution[level], residuum1[level], level, sync, res_norm);
+    }
 
-#pragma acc data present(    d_res0i[:s_res0i], d_err1i[:s_err1i], d_err1ip[:s_err1ip], \
-                            d_mg_tmpi[:s_mg_tmpi], d_res1i[:s_res1i], d_res1ip[:s_res1ip], \
-                            d_out[:s_out])
-        {
-            if (i == 0) // use p=out on finest grid
-            {
-                // smooth
-                Smooth(out, f_mg_tmpi, f_res1i, i, sync);
-
-                // calculate residuum
-                Residuum(f_res0i, out, f_res1i, i, sync);
-                boundary->applyBoundary(d_res0i, i, type_r0, sync); // for residuum0 only Dirichlet BC
-            } else {
-                // smooth
-                Smooth(f_err1i, f_mg_tmpi, f_res1i, i, sync);
+    if (res_norm != nullptr && *res_norm < m_tol_res) {
+        return;
+    }
 
-                // calculate residuum
-                Residuum(f_res0i, f_err1i, f_res1i, i, sync);
-                boundary->applyBoundary(d_res0i, i, type_r0, sync); // for residuum0 only Dirichlet BC
-            }
+//===================== coarser levels ======================//
+    if (level + 1 < static_cast<size_t>(levels)) {
+        if (type == CycleType::W_CYCLE) {
+            Cycle(out, level + 1, CycleType::W_CYCLE, sync);
+            Cycle(out, level + 1, CycleType::W_CYCLE, sync);
+        } else if (type == CycleType::F_CYCLE) {
+            Cycle(out, level + 1, CycleType::F_CYCLE, sync);
+            Cycle(out, level + 1, CycleType::V_CYCLE, sync);
+        } else {
+            Cycle(out, level + 1, CycleType::V_CYCLE, sync);
+        }
+    }
+
+    if (level == 0) {
+        CycleUp(out, m_tmp0, m_b0, level, sync);
+    } else {
+        CycleUp(error1[level], mg_temporal_solution[level], residuum1[level], level, sync);
+    }
+}
+
+//=================================== Cycle (down) ============================
+// *****************************************************************************
+/// \brief  Going down in a cycle: smooths on given level, restricts residuum to next coarser
+///         level and sets error there to zero
+/// \param  sol         solution at level (pressure on level 0, error else)
+/// \param  tmp         temporary field at level
+/// \param  b           right hand side at level
+/// \param  level       Multigrid level
+/// \param  sync        synchronization boolean (true=sync (default), false=async)
+/// \param  res_norm    if set, ||res|| on this level after pre-smoothing
+// *****************************************************************************
+template<typename T>
+void VCycleMG::CycleDown(FieldT<T> *sol, FieldT<T> *tmp, FieldT<T> *b, size_t level, bool sync, real *res_norm) {
+    auto domain = Domain::getInstance();
+    auto boundary = BoundaryController::getInstance();
+    size_t *d_iList = boundary->get_innerList_level_joined();
+    size_t *d_bList = boundary->get_boundaryList_level_joined();
+
+    const size_t i = level;
+
+    auto f_res1ip = residuum1[i + 1];
+
+    auto d_err1ip = error1[i + 1]->data;
+    auto d_tmp = tmp->data;
+    auto d_b = b->data;
+    auto d_res1ip = residuum1[i + 1]->data;
+    auto d_sol = sol->data;
+
+    auto s_err1ip = domain->get_size(error1[i + 1]->get_level());
+    auto s_sol = domain->get_size(sol->get_level());
+    auto s_res1ip = domain->get_size(residuum1[i + 1]->get_level());
+
+    FieldType type_r1 = residuum1[i + 1]->get_type();
+
+#pragma acc data present(    d_err1ip[:s_err1ip], \
+                            d_tmp[:s_sol], d_b[:s_sol], d_res1ip[:s_res1ip], \
+                            d_sol[:s_sol])
+    {
+        real *norm = res_norm;
+
+        // smooth
+        Smooth(sol, tmp, b, i, sync);
+
+        if (m_fused_restriction) {
+            // calculate residuum of fine cells and restrict in one pass
+            ResiduumRestrict(f_res1ip, sol, b, i, sync, norm);
+        } else {
+            // residuum0 is only allocated without fused restriction
+            auto f_res0i = residuum0[i];
+            auto d_res0i = f_res0i->data;
+            FieldType type_r0 = f_res0i->get_type();
+
+            // calculate residuum
+            Residuum(f_res0i, sol, b, i, sync, norm);
+            ApplyBoundary(d_res0i, i, type_r0, sync); // for residuum0 only Dirichlet BC
 
             // restrict
             Restrict(f_res1ip, f_res0i, i, sync);
-            boundary->applyBoundary(d_res1ip, i + 1, type_r1, sync); // for res only Dirichlet BC
+        }
+        ApplyBoundary(d_res1ip, i + 1, type_r1, sync); // for res only Dirichlet BC
 
-            // set err to zero at next level
+        // set err to zero at next level
 
-            // strides (since GPU needs joined list)
-            // inner start/ end index of level i + 1
-            size_t start_i = boundary->get_innerList_level_joined_start(i + 1);
-            size_t end_i = boundary->get_innerList_level_joined_end(i + 1) + 1;
-            // boundary start/ end index of level i + 1
-            size_t start_b = boundary->get_boundaryList_level_joined_start(i + 1);
-            size_t end_b = boundary->get_boundaryList_level_joined_end(i + 1) + 1;
-            // inner
+        // strides (since GPU needs joined list)
+        // inner start/ end index of level i + 1
+        size_t start_i = boundary->get_innerList_level_joined_start(i + 1);
+        size_t end_i = boundary->get_innerList_level_joined_end(i + 1) + 1;
+        // boundary start/ end index of level i + 1
+        size_t start_b = boundary->get_boundaryList_level_joined_start(i + 1);
+        size_t end_b = boundary->get_boundaryList_level_joined_end(i + 1) + 1;
+        // inner
+#pragma omp parallel for
 #pragma acc kernels present(d_err1ip[:s_err1ip], d_iList[start_i:(end_i-start_i)]) async
 #pragma acc loop independent
-            for (size_t j = start_i; j < end_i; ++j) {
-                const size_t idx = d_iList[j];
-                d_err1ip[idx] = 0.0;
-            }
+        for (size_t j = start_i; j < end_i; ++j) {
+            const size_t idx = d_iList[j];
+            d_err1ip[idx] = 0.0;
+        }
 
-            //boundary
+        //boundary
+#pragma omp parallel for
 #pragma acc kernels present(d_err1ip[:s_err1ip], d_bList[start_b:(end_b-start_b)]) async
 #pragma acc loop independent
-            for (size_t j = start_b; j < end_b; ++j) {
-                const size_t idx = d_bList[j];
-                d_err1ip[idx] = 0.0;
-            }
-        } //end data  region
-    } //for (levels going down)
+        for (size_t j = start_b; j < end_b; ++j) {
+            const size_t idx = d_bList[j];
+            d_err1ip[idx] = 0.0;
+        }
+    } //end data  region
+}
 
-//===================== levels going up ====================//
-    for (size_t i = max_level; i > 0; --i) {
+//=================================== Cycle (up) ==============================
+// *****************************************************************************
+/// \brief  Going up in a cycle: prolongates error of next coarser level, corrects solution
+///         on given level and smooths (solves at levels - 1)
+/// \param  sol         solution at level (pressure on level 0, error else)
+/// \param  tmp         temporary field at level
+/// \param  b           right hand side at level
+/// \param  level       Multigrid level
+/// \param  sync        synchronization boolean (true=sync (default), false=async)
+// *****************************************************************************
+template<typename T>
+void VCycleMG::CycleUp(FieldT<T> *sol, FieldT<T> *tmp, FieldT<T> *b, size_t level, bool sync) {
+    auto domain = Domain::getInstance();
+    auto boundary = BoundaryController::getInstance();
 
-        auto f_err0i = err0[i];
-        auto f_err1i = error1[i];
-        auto f_err1im = error1[i - 1];
-        auto f_mg_tmpim = mg_temporal_solution[i - 1];
-        auto f_res1im = residuum1[i - 1];
+    const size_t i = level + 1;
 
-        auto d_err0i = err0[i]->data;
-        auto d_err1i = error1[i]->data;
-        auto d_err1im = error1[i - 1]->data;
-        auto d_mg_tmpim = mg_temporal_solution[i - 1]->data;
-        auto d_res1im = residuum1[i - 1]->data;
-        auto d_out = out->data;
+    auto f_err0i = err0[i];
+    auto f_err1i = error1[i];
 
-        auto s_err0i = domain->get_size(err0[i]->get_level());
-        auto s_err1i = domain->get_size(error1[i]->get_level());
-        auto s_err1im = domain->get_size(error1[i - 1]->get_level());
-        auto s_mg_tmpim = domain->get_size(mg_temporal_solution[i - 1]->get_level());
-        auto s_res1im = domain->get_size(residuum1[i - 1]->get_level());
-        auto s_out = domain->get_size(out->get_level());
+    auto d_err0i = err0[i]->data;
+    auto d_err1i = error1[i]->data;
+    auto d_tmp = tmp->data;
+    auto d_b = b->data;
+    auto d_sol = sol->data;
 
-        size_t Nx_e0 = domain->get_Nx(f_err0i->get_level());
-        size_t Ny_e0 = domain->get_Ny(f_err0i->get_level());
-        size_t Nz_e0 = domain->get_Nz(f_err0i->get_level());
+    auto s_err0i = domain->get_size(err0[i]->get_level());
+    auto s_err1i = domain->get_size(error1[i]->get_level());
+    auto s_sol = domain->get_size(sol->get_level());
 
-        real dx_e0 = domain->get_dx(f_err0i->get_level());
-        real dy_e0 = domain->get_dy(f_err0i->get_level());
-        real dz_e0 = domain->get_dz(f_err0i->get_level());
+    FieldType type_e0 = f_err0i->get_type();
 
-        FieldType type_e0 = f_err0i->get_type();
+#pragma acc data present(d_err0i[:s_err0i], d_err1i[:s_err1i], d_tmp[:s_sol], d_b[:s_sol], d_sol[:s_sol])
+    {
+        // prolongate
+        Prolongate(f_err0i, f_err1i, i, sync);
+        ApplyBoundary(d_err0i, i - 1, type_e0, sync); // for err0 only Dirichlet BC
 
-        // inner start/ end index of level i - 1
-        size_t start_i = boundary->get_innerList_level_joined_start(i - 1);
-        size_t end_i = boundary->get_innerList_level_joined_end(i - 1) + 1;
-        // boundary start/ end index of level i - 1
-        size_t start_b = boundary->get_boundaryList_level_joined_start(i - 1);
-        size_t end_b = boundary->get_boundaryList_level_joined_end(i - 1) + 1;
+        // correct
+        Correct(sol, f_err0i, i - 1, false, sync);
 
-#pragma acc data present(d_err0i[:s_err0i], d_err1i[:s_err1i], d_err1im[:s_err1im], d_mg_tmpim[:s_mg_tmpim], d_res1im[:s_res1im], d_out[:s_out])
-        {
-            // prolongate
-            Prolongate(f_err0i, f_err1i, i, sync);
-            boundary->applyBoundary(d_err0i, i - 1, type_e0, sync); // for err0 only Dirichlet BC
+        // smooth
+        if (i - 1 > 0 && i - 1 == static_cast<size_t>(levels) - 1) Solve(sol, tmp, b, i - 1, sync);
+        else Smooth(sol, tmp, b, i - 1, sync); // for err only Dirichlet BC
+    } //end data region
+}
 
-            // correct
-            if (i == 1) // use p=out on finest grid
-            {
-                // inner
-#pragma acc kernels present(d_err0i[:s_err0i], d_out[:s_out], d_iList[start_i:(end_i-start_i)]) async
-                {
+//==================================== Correct ================================
+// *****************************************************************************
+/// \brief  Adds prolongated error to solution (or replaces solution by it) in inner and
+///         boundary cells
+/// \param  out         solution at level (pressure on level 0, error else)
+/// \param  err         prolongated error at level
+/// \param  level       Multigrid level
+/// \param  replace     overwrite out instead of adding err to it
+/// \param  sync        synchronization boolean (true=sync (default), false=async)
+// *****************************************************************************
+template<typename T>
+void VCycleMG::Correct(FieldT<T> *out, FieldLP *err, size_t level, bool replace, bool sync) {
+    auto domain = Domain::getInstance();
+    auto boundary = BoundaryController::getInstance();
+    size_t *d_iList = boundary->get_innerList_level_joined();
+    size_t *d_bList = boundary->get_boundaryList_level_joined();
+
+    auto d_out = out->data;
+    auto d_err = err->data;
+    auto s_out = domain->get_size(out->get_level());
+
+    // inner start/ end index of level
+    size_t start_i = boundary->get_innerList_level_joined_start(level);
+    size_t end_i = boundary->get_innerList_level_joined_end(level) + 1;
+    // boundary start/ end index of level
+    size_t start_b = boundary->get_boundaryList_level_joined_start(level);
+    size_t end_b = boundary->get_boundaryList_level_joined_end(level) + 1;
+
+    if (replace) {
+        // inner
+#pragma acc kernels present(d_err[:s_out], d_out[:s_out], d_iList[start_i:(end_i-start_i)]) async
+        {
+#pragma omp parallel for
 #pragma acc loop independent
-                    for (size_t j = start_i; j < end_i; ++j) {
-                        const size_t idx = d_iList[j];
-                        d_out[idx] += d_err0i[idx];
-                    }
-                }
-                // boundary
-#pragma acc kernels present(d_err0i[:s_err0i], d_out[:s_out], d_bList[start_b:(end_b-start_b)]) async
-                {
+            for (size_t j = start_i; j < end_i; ++j) {
+                const size_t idx = d_iList[j];
+                d_out[idx] = d_err[idx];
+            }
+        }
+        // boundary
+#pragma acc kernels present(d_err[:s_out], d_out[:s_out], d_bList[start_b:(end_b-start_b)]) async
+        {
+#pragma omp parallel for
 #pragma acc loop independent
-                    for (size_t j = start_b; j < end_b; ++j) {
-                        const size_t idx = d_bList[j];
-                        d_out[idx] += d_err0i[idx];
-                    }
-                }
-                // smooth
-                Smooth(out, f_mg_tmpim, f_res1im, i - 1, sync);
-            } else {
-                // correct
-                // inner
-#pragma acc kernels present(d_err0i[:s_err0i], d_err1im[:s_err1im], d_iList[start_i:(end_i-start_i)]) async
-                {
+            for (size_t j = start_b; j < end_b; ++j) {
+                const size_t idx = d_bList[j];
+                d_out[idx] = d_err[idx];
+            }
+        }
+    } else {
+        // inner
+#pragma acc kernels present(d_err[:s_out], d_out[:s_out], d_iList[start_i:(end_i-start_i)]) async
+        {
+#pragma omp parallel for
 #pragma acc loop independent
-                    for (size_t j = start_i; j < end_i; ++j) {
-                        const size_t idx = d_iList[j];
-                        d_err1im[idx] += d_err0i[idx];
-                    }
-                }
-                // boundary
-#pragma acc kernels present(d_err0i[:s_err0i], d_err1im[:s_err1im], d_bList[start_b:(end_b-start_b)]) async
-                {
+            for (size_t j = start_i; j < end_i; ++j) {
+                const size_t idx = d_iList[j];
+                d_out[idx] += d_err[idx];
+            }
+        }
+        // boundary
+#pragma acc kernels present(d_err[:s_out], d_out[:s_out], d_bList[start_b:(end_b-start_b)]) async
+        {
+#pragma omp parallel for
 #pragma acc loop independent
-                    for (size_t j = start_b; j < end_b; ++j) {
-                        const size_t idx = d_bList[j];
-                        d_err1im[idx] += d_err0i[idx];
-                    }
-                }
-                // smooth
-                if (i - 1 == levels - 1) Solve(f_err1im, f_mg_tmpim, f_res1im, i - 1, sync);
-                else Smooth(f_err1im, f_mg_tmpim, f_res1im, i - 1, sync); // for err only Dirichlet BC
+            for (size_t j = start_b; j < end_b; ++j) {
+                const size_t idx = d_bList[j];
+                d_out[idx] += d_err[idx];
             }
-        } //end data region
-    }//for (levels going up)
-
-    // set boundaries
-
-    auto d_out = out->data;
-    FieldType type = out->get_type();
-
-    boundary->applyBoundary(d_out, type, sync);
+        }
+    }
 
     if (sync) {
 #pragma acc wait
@@ -568,7 +887,15 @@ void VCycleMG::VCycleMultigrid(Field *out, bool sync) {
 /// \param  level       Multigrid level
 /// \param  sync        synchronization boolean (true=sync (default), false=async)
 // *****************************************************************************
-void VCycleMG::Smooth(Field *out, Field *tmp, Field *b, size_t level, bool sync) {
+template<typename T>
+void VCycleMG::Smooth(FieldT<T> *out, FieldT<T> *tmp, FieldT<T> *b, size_t level, bool sync) {
+    if constexpr (std::is_same<T, real>::value) {
+        if (m_wavefront_smooth && level == 0 && relaxs > 2) {
+            SmoothWavefront(out, b, level, sync);
+            return;
+        }
+    }
+
     auto domain = Domain::getInstance();
 
     // local variables and parameters for GPU
@@ -599,7 +926,7 @@ void VCycleMG::Smooth(Field *out, Field *tmp, Field *b, size_t level, bool sync)
     size_t end_b = boundary->get_boundaryList_level_joined_end(level) + 1;
 
     // apply boundary: at level 0 apply set BC; else use Dirichlet 0
-    boundary->applyBoundary(d_out, level, type, sync);
+    ApplyBoundary(d_out, level, type, sync);
 
     // diffuse
     const real rdx2 = 1. / (dx * dx);
@@ -618,6 +945,7 @@ void VCycleMG::Smooth(Field *out, Field *tmp, Field *b, size_t level, bool sync)
     {
         // initialization
         // inner
+#pragma omp parallel for
 #pragma acc kernels present(d_iList[start_i:(end_i-start_i)]) async
 #pragma acc loop independent
         for (size_t j = start_i; j < end_i; ++j) {
@@ -626,6 +954,7 @@ void VCycleMG::Smooth(Field *out, Field *tmp, Field *b, size_t level, bool sync)
         }
 
         // boundary
+#pragma omp parallel for
 #pragma acc kernels present(d_bList[start_b:(end_b-start_b)]) async
 #pragma acc loop independent
         for (size_t j = start_b; j < end_b; ++j) {
@@ -642,13 +971,14 @@ void VCycleMG::Smooth(Field *out, Field *tmp, Field *b, size_t level, bool sync)
         {
             for (int i=0; i<relaxs; i++) { // fixed iteration number as in xml
                 JacobiDiffuse::JacobiStep(level, out, tmp, b, alphaX, alphaY, alphaZ, beta, m_dsign, m_w, sync);
-                boundary->applyBoundary(d_out, level, type, sync);
+                ApplyBoundary(d_out, level, type, sync);
 
                 std::swap(tmp->data, out->data);
                 std::swap(d_tmp, d_out);
             }
 
             if (relaxs % 2 != 0) { // swap necessary when odd number of iterations
+#pragma omp parallel for
 #pragma acc kernels present(d_out[:bsize], d_tmp[:bsize], d_iList[start_i:(end_i-start_i)]) async
 #pragma acc loop independent
                 // inner
@@ -657,6 +987,7 @@ void VCycleMG::Smooth(Field *out, Field *tmp, Field *b, size_t level, bool sync)
                     d_out[i] = d_tmp[i];
                 }
                 // boundary
+#pragma omp parallel for
 #pragma acc kernels present(d_out[:bsize], d_tmp[:bsize], d_bList[start_b:(end_b-start_b)]) async
 #pragma acc loop independent
                 for (size_t j = start_b; j < end_b; ++j) {
@@ -670,8 +1001,12 @@ void VCycleMG::Smooth(Field *out, Field *tmp, Field *b, size_t level, bool sync)
 #pragma acc data present(d_out[:bsize], d_tmp[:bsize], d_b[:bsize])
         {
             for (int i=0; i<relaxs; i++) {
-                ColoredGaussSeidelDiffuse::colored_gauss_seidel_step(out, b, alphaX, alphaY, alphaZ, beta, m_dsign, m_w, sync);
-                boundary->applyBoundary(d_out, level, type, sync); // for res/err only Dirichlet BC
+                if (m_row_split) {
+                    ColoredGaussSeidelDiffuse::red_black_step(out, b, alphaX, alphaY, alphaZ, beta, m_dsign, m_w, sync);
+                } else {
+                    ColoredGaussSeidelDiffuse::colored_gauss_seidel_step(out, b, alphaX, alphaY, alphaZ, beta, m_dsign, m_w, sync);
+                }
+                ApplyBoundary(d_out, level, type, sync); // for res/err only Dirichlet BC
             }
         } //end data region
     } else {
@@ -687,6 +1022,156 @@ void VCycleMG::Smooth(Field *out, Field *tmp, Field *b, size_t level, bool sync)
     }
 }
 
+//============================== Smooth (wavefront) ===========================
+// *****************************************************************************
+/// \brief  Relaxes Ax = b with relaxs Jacobi sweeps, temporally blocked along z:
+///         sweep s updates plane k as soon as sweep s-1 has finished plane k+1.
+///         Intermediate sweeps are kept in rings of four planes (cache resident),
+///         thus out and b are streamed once instead of relaxs times. Result equals
+///         the JacobiStep loop of Smooth including boundary conditions
+/// \param  out         output field (updated in place)
+/// \param  b           right hand side
+/// \param  level       Multigrid level
+/// \param  sync        synchronization boolean (true=sync (default), false=async)
+// *****************************************************************************
+void VCycleMG::SmoothWavefront(Field *out, Field *b, size_t level, bool sync) {
+    auto domain = Domain::getInstance();
+
+    // local variables and parameters
+    const size_t Nx = domain->get_Nx(level);
+    const size_t Ny = domain->get_Ny(level);
+    const size_t Nxy = Nx * Ny;
+
+    const real dx = domain->get_dx(level);
+    const real dy = domain->get_dy(level);
+    const real dz = domain->get_dz(level);
+
+    const real alphaX = 1. / (dx * dx);
+    const real alphaY = 1. / (dy * dy);
+    const real alphaZ = 1. / (dz * dz);
+
+    const real rbeta = 2. * (alphaX + alphaY + alphaZ);
+    const real beta = 1. / rbeta;
+
+    const real dsign = m_dsign;
+    const real w = m_w;
+
+    const size_t i1 = domain->get_index_x1(level);
+    const size_t i2 = domain->get_index_x2(level);
+    const size_t j1 = domain->get_index_y1(level);
+    const size_t j2 = domain->get_index_y2(level);
+    const size_t k1 = domain->get_index_z1(level);
+    const size_t k2 = domain->get_index_z2(level);
+
+    // the Jacobi loop in Smooth ends on the swapped buffer for an even number of iterations,
+    // hence out holds the result of relaxs - 1 sweeps then; reproduce this
+    const size_t n_sweeps = static_cast<size_t> (relaxs % 2 == 0 ? relaxs - 1 : relaxs);
+
+    // ring of four planes for each intermediate sweep (planes k-2, k-1, k and a ghost plane),
+    // relaxs may grow in the first time step
+    if (m_wavefront_planes.size() < 4 * (n_sweeps - 1) * Nxy) {
+        m_wavefront_planes.resize(4 * (n_sweeps - 1) * Nxy);
+    }
+
+    auto d_out = out->data;
+    auto d_b = b->data;
+    auto d_planes = m_wavefront_planes.data();
+
+    FieldType type = out->get_type();
+    auto boundary = BoundaryController::getInstance();
+
+    // ghost cell rules of domain patches (ghost = sign * data[ghost + offset] + value)
+    BoundaryData *boundary_data = boundary->get_domain_boundary_data(type);
+    long int offset[numberOfPatches];
+    real sign[numberOfPatches];
+    real value[numberOfPatches];
+    for (size_t patch = 0; patch < numberOfPatches; ++patch) {
+        DomainBoundary::get_ghost_rule(static_cast<Patch>(patch), level, boundary_data, offset[patch], sign[patch], value[patch]);
+        if (m_homogeneous) {
+            value[patch] = 0;
+        }
+    }
+
+    // apply boundary: at level 0 apply set BC; else use Dirichlet 0
+    ApplyBoundary(d_out, level, type, sync);
+
+    // sweep 0 (input) and sweep relaxs (output) share out, sweeps in between use plane rings
+    auto plane = [=](size_t s, size_t k) {
+        return (s == 0 || s == n_sweeps) ? d_out + k * Nxy : d_planes + (4 * (s - 1) + k % 4) * Nxy;
+    };
+
+    // sweep s handles plane k1 + t - (s - 1) in step t
+    const size_t n_steps = (k2 - k1 + 1) + n_sweeps - 1;
+#pragma omp parallel
+    {
+        for (size_t t = 0; t < n_steps; ++t) {
+            for (size_t s = 1; s <= n_sweeps && s <= t + 1; ++s) {
+                const size_t k = k1 + t - (s - 1);
+                if (k > k2) continue;
+
+                const real *in_c = plane(s - 1, k);
+                const real *in_m = plane(s - 1, k - 1);
+                const real *in_p = plane(s - 1, k + 1);
+                const real *b_c = d_b + k * Nxy;
+                real *res = plane(s, k);
+
+#pragma omp for
+                for (size_t j = j1; j <= j2; ++j) {
+                    for (size_t i = i1; i <= i2; ++i) {
+                        const size_t idx = IX(i, j, 0, Nx, Ny);
+                        real out_h = beta * (dsign * b_c[idx] + alphaX * (in_c[idx + 1] + in_c[idx - 1]) \
+ + alphaY * (in_c[idx + Nx] + in_c[idx - Nx]) \
+ + alphaZ * (in_p[idx] + in_m[idx]));
+                        res[idx] = (1 - w) * in_c[idx] + w * out_h;
+                    }
+                }
+                if (s == n_sweeps) continue;  // boundary of result set afterwards
+
+                // ghost cells of intermediate sweep depending on this plane
+#pragma omp single
+                {
+                    for (size_t j = j1; j <= j2; ++j) {
+                        const size_t idx_l = IX(i1 - 1, j, 0, Nx, Ny);
+                        const size_t idx_r = IX(i2 + 1, j, 0, Nx, Ny);
+                        res[idx_l] = sign[LEFT] * res[idx_l + offset[LEFT]] + value[LEFT];
+                        res[idx_r] = sign[RIGHT] * res[idx_r + offset[RIGHT]] + value[RIGHT];
+                    }
+                    for (size_t i = i1; i <= i2; ++i) {
+                        const size_t idx_b = IX(i, j1 - 1, 0, Nx, Ny);
+                        const size_t idx_t = IX(i, j2 + 1, 0, Nx, Ny);
+                        res[idx_b] = sign[BOTTOM] * res[idx_b + offset[BOTTOM]] + value[BOTTOM];
+                        res[idx_t] = sign[TOP] * res[idx_t + offset[TOP]] + value[TOP];
+                    }
+                }
+                if (k == k1 || k == k2) {
+                    // front/ back ghost plane references its neighbouring inner plane only
+                    const Patch patch = (k == k1) ? FRONT : BACK;
+                    real *ghost = plane(s, k == k1 ? k - 1 : k + 1);
+#pragma omp for
+                    for (size_t j = j1; j <= j2; ++j) {
+                        for (size_t i = i1; i <= i2; ++i) {
+                            const size_t idx = IX(i, j, 0, Nx, Ny);
+                            ghost[idx] = sign[patch] * res[idx] + value[patch];
+                        }
+                    }
+                    if (k1 == k2) {  // single inner plane references both ghost planes
+                        real *ghost_back = plane(s, k + 1);
+#pragma omp for
+                        for (size_t j = j1; j <= j2; ++j) {
+                            for (size_t i = i1; i <= i2; ++i) {
+                                const size_t idx = IX(i, j, 0, Nx, Ny);
+                                ghost_back[idx] = sign[BACK] * res[idx] + value[BACK];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    ApplyBoundary(d_out, level, type, sync);
+}
+
 //================================== Residuum ===============================
 // ************************************************************************
 /// \brief  Calculates residuum r = b - Ax
@@ -695,8 +1180,10 @@ void VCycleMG::Smooth(Field *out, Field *tmp, Field *b, size_t level, bool sync)
 /// \param  b           right hand side field
 /// \param  level       Multigrid level
 /// \param  sync        synchronization boolean (true=sync (default), false=async)
+/// \param  res_norm    if set, ||r|| in inner cells
 // ************************************************************************
-void VCycleMG::Residuum(Field *out, Field *in, Field *b, size_t level, bool sync) {
+template<typename T>
+void VCycleMG::Residuum(FieldLP *out, FieldT<T> *in, FieldT<T> *b, size_t level, bool sync, real *res_norm) {
     auto domain = Domain::getInstance();
 
     // local variables and parameters for GPU
@@ -718,27 +1205,64 @@ void VCycleMG::Residuum(Field *out, Field *in, Field *b, size_t level, bool sync
     size_t bsize = domain->get_size(out->get_level());
 
     auto boundary = BoundaryController::getInstance();
-    size_t *d_iList = boundary->get_innerList_level_joined();
+    size_t *d_rStart = boundary->get_innerRuns_start_level_joined();
+    size_t *d_rLen = boundary->get_innerRuns_length_level_joined();
 
     // starts/ ends
-    // inner
-    size_t start_i = boundary->get_innerList_level_joined_start(level);
-    size_t end_i = boundary->get_innerList_level_joined_end(level) + 1;
-#pragma acc data present(d_b[:bsize], d_in[:bsize], d_out[:bsize], d_iList[start_i:(end_i-start_i)])
+    // inner runs
+    size_t start_r = boundary->get_innerRuns_level_joined_start(level);
+    size_t end_r = boundary->get_innerRuns_level_joined_end(level) + 1;
+    real sum = 0.;
+#pragma acc data present(d_b[:bsize], d_in[:bsize], d_out[:bsize], d_rStart[start_r:(end_r-start_r)], d_rLen[start_r:(end_r-start_r)])
     {
-#pragma acc kernels async
+        if (!boundary->hasObstacles()) {
+            // inner cells form a dense box, iterate structured without index list
+            const size_t i1 = domain->get_index_x1(level);
+            const size_t i2 = domain->get_index_x2(level);
+            const size_t j1 = domain->get_index_y1(level);
+            const size_t j2 = domain->get_index_y2(level);
+            const size_t k1 = domain->get_index_z1(level);
+            const size_t k2 = domain->get_index_z2(level);
+
+#pragma omp parallel for collapse(2) reduction(+:sum)
+#pragma acc parallel loop independent collapse(3) reduction(+:sum) async
+            for (size_t k = k1; k <= k2; ++k) {
+                for (size_t j = j1; j <= j2; ++j) {
+                    for (size_t i = i1; i <= i2; ++i) {
+                        const size_t idx = IX(i, j, k, Nx, Ny);
+                        const real r_i = d_b[idx] - (rdx2 * (d_in[idx - 1] - 2 * d_in[idx] + d_in[idx + 1])\
+ + rdy2 * (d_in[idx - Nx] - 2 * d_in[idx] + d_in[idx + Nx])\
+ + rdz2 * (d_in[idx - Nx * Ny] - 2 * d_in[idx] + d_in[idx + Nx * Ny]));
+                        d_out[idx] = r_i;
+                        sum += r_i * r_i;
+                    }
+                }
+            }
+        } else {
+            // inner cells as runs of consecutive indices, unit stride within each run
+#pragma omp parallel for reduction(+:sum)
+#pragma acc parallel loop independent reduction(+:sum) async
+            for (size_t r = start_r; r < end_r; ++r) {
+                const size_t first = d_rStart[r];
+                const size_t last = first + d_rLen[r];
 #pragma acc loop independent
-        for (size_t j = start_i; j < end_i; ++j) {
-            const size_t i = d_iList[j];
-            d_out[i] = d_b[i] - (rdx2 * (d_in[i - 1] - 2 * d_in[i] + d_in[i + 1])\
+                for (size_t i = first; i < last; ++i) {
+                    const real r_i = d_b[i] - (rdx2 * (d_in[i - 1] - 2 * d_in[i] + d_in[i + 1])\
  + rdy2 * (d_in[i - Nx] - 2 * d_in[i] + d_in[i + Nx])\
  + rdz2 * (d_in[i - Nx * Ny] - 2 * d_in[i] + d_in[i + Nx * Ny]));
+                    d_out[i] = r_i;
+                    sum += r_i * r_i;
+                }
+            }
         }
 
-        if (sync) {
+        // wait for reduction
 #pragma acc wait
-        }
     }//end data region
+
+    if (res_norm != nullptr) {
+        *res_norm = sqrt(sum);
+    }
 }
 
 //================================== Restrict ===============================
@@ -749,7 +1273,8 @@ void VCycleMG::Residuum(Field *out, Field *in, Field *b, size_t level, bool sync
 /// \param  level       Multigrid level
 /// \param  sync        synchronization boolean (true=sync (default), false=async)
 // *****************************************************************************
-void VCycleMG::Restrict(Field *out, Field *in, size_t level, bool sync) {
+template<typename T>
+void VCycleMG::Restrict(FieldLP *out, FieldT<T> *in, size_t level, bool sync) {
     auto domain = Domain::getInstance();
 
     // local variables and parameters for GPU
@@ -768,15 +1293,16 @@ void VCycleMG::Restrict(Field *out, Field *in, size_t level, bool sync) {
     size_t bsize_in = domain->get_size(in->get_level());
 
     auto boundary = BoundaryController::getInstance();
-    size_t *d_iList = boundary->get_innerList_level_joined();
+    size_t *d_rStart = boundary->get_innerRuns_start_level_joined();
+    size_t *d_rLen = boundary->get_innerRuns_length_level_joined();
 
     // start/end
-    // inner
-    size_t start_i = boundary->get_innerList_level_joined_start(level + 1);
-    size_t end_i = boundary->get_innerList_level_joined_end(level + 1) + 1;
+    // inner runs
+    size_t start_r = boundary->get_innerRuns_level_joined_start(level + 1);
+    size_t end_r = boundary->get_innerRuns_level_joined_end(level + 1) + 1;
 
 #ifndef BENCHMARKING
-    if (end_i == start_i) {
+    if (end_r == start_r) {
         m_logger->warn("Be cautious: Obstacle might fill up inner cells completely in level {} with nx= {}!",
                        level, domain->get_nx(out->get_level()));
     }
@@ -785,19 +1311,47 @@ void VCycleMG::Restrict(Field *out, Field *in, size_t level, bool sync) {
     // average from eight neighboring cells
     // obstacles not used in fine grid, since coarse grid only obstacle if one of 8 fine grids was an obstacle,
     // thus if coarse cell inner cell, then surrounding fine cells also inner cells!
-    size_t i, j, k;
 
-#pragma acc data present(d_in[:bsize_in], d_out[:bsize_out], d_iList[start_i:(end_i-start_i)])
+#pragma acc data present(d_in[:bsize_in], d_out[:bsize_out], d_rStart[start_r:(end_r-start_r)], d_rLen[start_r:(end_r-start_r)])
     {
-#pragma acc kernels async
+        if (!boundary->hasObstacles()) {
+            // inner cells form a dense box, iterate structured without index list
+            const size_t i1 = domain->get_index_x1(level + 1);
+            const size_t i2 = domain->get_index_x2(level + 1);
+            const size_t j1 = domain->get_index_y1(level + 1);
+            const size_t j2 = domain->get_index_y2(level + 1);
+            const size_t k1 = domain->get_index_z1(level + 1);
+            const size_t k2 = domain->get_index_z2(level + 1);
+
+#pragma omp parallel for collapse(2)
+#pragma acc parallel loop independent collapse(3) async
+            for (size_t k = k1; k <= k2; ++k) {
+                for (size_t j = j1; j <= j2; ++j) {
+                    for (size_t i = i1; i <= i2; ++i) {
+                        d_out[IX(i, j, k, Nx, Ny)] = 0.125 * (d_in[IX(2 * i - 1, 2 * j - 1, 2 * k - 1, nx, ny)]\
+ + d_in[IX(2 * i, 2 * j - 1, 2 * k - 1, nx, ny)]\
+ + d_in[IX(2 * i - 1, 2 * j, 2 * k - 1, nx, ny)]\
+ + d_in[IX(2 * i, 2 * j, 2 * k - 1, nx, ny)]\
+ + d_in[IX(2 * i - 1, 2 * j - 1, 2 * k, nx, ny)]\
+ + d_in[IX(2 * i, 2 * j - 1, 2 * k, nx, ny)]\
+ + d_in[IX(2 * i - 1, 2 * j, 2 * k, nx, ny)]\
+ + d_in[IX(2 * i, 2 * j, 2 * k, nx, ny)]);
+                    }
+                }
+            }
+        } else {
+            // inner cells as runs of consecutive indices, a run never leaves its row (j, k)
+#pragma omp parallel for
+#pragma acc parallel loop independent async
+            for (size_t r = start_r; r < end_r; ++r) {
+                const size_t first = d_rStart[r];
+                const size_t k = first / (Nx * Ny);
+                const size_t j = (first - k * Nx * Ny) / Nx;
+                const size_t i_first = first - k * Nx * Ny - j * Nx;
+                const size_t i_last = i_first + d_rLen[r];
 #pragma acc loop independent
-        for (size_t l = start_i; l < end_i; ++l) {
-            const size_t idx = d_iList[l];
-            k = idx / (Nx * Ny);
-            j = (idx - k * Nx * Ny) / Nx;
-            i = idx - k * Nx * Ny - j * Nx;
-
-            d_out[idx] = 0.125 * (d_in[IX(2 * i - 1, 2 * j - 1, 2 * k - 1, nx, ny)]\
+                for (size_t i = i_first; i < i_last; ++i) {
+                    d_out[IX(i, j, k, Nx, Ny)] = 0.125 * (d_in[IX(2 * i - 1, 2 * j - 1, 2 * k - 1, nx, ny)]\
  + d_in[IX(2 * i, 2 * j - 1, 2 * k - 1, nx, ny)]\
  + d_in[IX(2 * i - 1, 2 * j, 2 * k - 1, nx, ny)]\
  + d_in[IX(2 * i, 2 * j, 2 * k - 1, nx, ny)]\
@@ -805,7 +1359,8 @@ void VCycleMG::Restrict(Field *out, Field *in, size_t level, bool sync) {
  + d_in[IX(2 * i, 2 * j - 1, 2 * k, nx, ny)]\
  + d_in[IX(2 * i - 1, 2 * j, 2 * k, nx, ny)]\
  + d_in[IX(2 * i, 2 * j, 2 * k, nx, ny)]);
-
+                }
+            }
         }
 
         if (sync) {
@@ -814,6 +1369,123 @@ void VCycleMG::Restrict(Field *out, Field *in, size_t level, bool sync) {
     }// end data region
 }
 
+//============================= Residuum + Restrict ===========================
+// *****************************************************************************
+/// \brief  Calculates residuum r = b - Ax of the eight fine cells of each coarse cell and
+///         restricts it via averaging, without storing the fine residuum
+/// \param  out         output field (coarse grid)
+/// \param  in          solution on fine grid
+/// \param  b           right hand side on fine grid
+/// \param  level       Multigrid level (fine grid)
+/// \param  sync        synchronization boolean (true=sync (default), false=async)
+/// \param  res_norm    if set, ||r|| in restricted fine cells
+// *****************************************************************************
+template<typename T>
+void VCycleMG::ResiduumRestrict(FieldLP *out, FieldT<T> *in, FieldT<T> *b, size_t level, bool sync, real *res_norm) {
+    auto domain = Domain::getInstance();
+
+    // local variables and parameters for GPU
+    // coarse grid
+    const size_t Nx = domain->get_Nx(out->get_level());
+    const size_t Ny = domain->get_Ny(out->get_level());
+
+    // fine grid
+    const size_t nx = domain->get_Nx(in->get_level());
+    const size_t ny = domain->get_Ny(in->get_level());
+
+    const real dx = domain->get_dx(in->get_level());
+    const real dy = domain->get_dy(in->get_level());
+    const real dz = domain->get_dz(in->get_level());
+
+    const real rdx2 = 1. / (dx * dx);
+    const real rdy2 = 1. / (dy * dy);
+    const real rdz2 = 1. / (dz * dz);
+
+    auto d_out = out->data;
+    auto d_in = in->data;
+    auto d_b = b->data;
+
+    size_t bsize_out = domain->get_size(out->get_level());
+    size_t bsize_in = domain->get_size(in->get_level());
+
+    auto boundary = BoundaryController::getInstance();
+    size_t *d_rStart = boundary->get_innerRuns_start_level_joined();
+    size_t *d_rLen = boundary->get_innerRuns_length_level_joined();
+
+    // start/end
+    // inner runs of coarse grid
+    size_t start_r = boundary->get_innerRuns_level_joined_start(level + 1);
+    size_t end_r = boundary->get_innerRuns_level_joined_end(level + 1) + 1;
+
+    // coarse inner cell -> fine inner cells (see Restrict), fine cell (2i-1+di, 2j-1+dj, 2k-1+dk)
+    // for child c with di = c&1, dj = (c>>1)&1, dk = (c>>2)&1, summed in the order of Restrict
+    real sum_sq = 0.;
+#pragma acc data present(d_in[:bsize_in], d_b[:bsize_in], d_out[:bsize_out], d_rStart[start_r:(end_r-start_r)], d_rLen[start_r:(end_r-start_r)])
+    {
+        if (!boundary->hasObstacles()) {
+            // inner cells form a dense box, iterate structured without index list
+            const size_t i1 = domain->get_index_x1(level + 1);
+            const size_t i2 = domain->get_index_x2(level + 1);
+            const size_t j1 = domain->get_index_y1(level + 1);
+            const size_t j2 = domain->get_index_y2(level + 1);
+            const size_t k1 = domain->get_index_z1(level + 1);
+            const size_t k2 = domain->get_index_z2(level + 1);
+
+#pragma omp parallel for collapse(2) reduction(+:sum_sq)
+#pragma acc parallel loop independent collapse(3) reduction(+:sum_sq) async
+            for (size_t k = k1; k <= k2; ++k) {
+                for (size_t j = j1; j <= j2; ++j) {
+                    for (size_t i = i1; i <= i2; ++i) {
+                        real sum = 0.;
+#pragma acc loop seq
+                        for (size_t c = 0; c < 8; ++c) {
+                            const size_t f = IX(2 * i - 1 + (c & 1), 2 * j - 1 + ((c >> 1) & 1), 2 * k - 1 + ((c >> 2) & 1), nx, ny);
+                            const real r_f = d_b[f] - (rdx2 * (d_in[f - 1] - 2 * d_in[f] + d_in[f + 1])\
+ + rdy2 * (d_in[f - nx] - 2 * d_in[f] + d_in[f + nx])\
+ + rdz2 * (d_in[f - nx * ny] - 2 * d_in[f] + d_in[f + nx * ny]));
+                            sum += r_f;
+                            sum_sq += r_f * r_f;
+                        }
+                        d_out[IX(i, j, k, Nx, Ny)] = 0.125 * sum;
+                    }
+                }
+            }
+        } else {
+            // inner cells as runs of consecutive indices, a run never leaves its row (j, k)
+#pragma omp parallel for reduction(+:sum_sq)
+#pragma acc parallel loop independent reduction(+:sum_sq) async
+            for (size_t r = start_r; r < end_r; ++r) {
+                const size_t first = d_rStart[r];
+                const size_t k = first / (Nx * Ny);
+                const size_t j = (first - k * Nx * Ny) / Nx;
+                const size_t i_first = first - k * Nx * Ny - j * Nx;
+                const size_t i_last = i_first + d_rLen[r];
+#pragma acc loop independent
+                for (size_t i = i_first; i < i_last; ++i) {
+                    real sum = 0.;
+#pragma acc loop seq
+                    for (size_t c = 0; c < 8; ++c) {
+                        const size_t f = IX(2 * i - 1 + (c & 1), 2 * j - 1 + ((c >> 1) & 1), 2 * k - 1 + ((c >> 2) & 1), nx, ny);
+                        const real r_f = d_b[f] - (rdx2 * (d_in[f - 1] - 2 * d_in[f] + d_in[f + 1])\
+ + rdy2 * (d_in[f - nx] - 2 * d_in[f] + d_in[f + nx])\
+ + rdz2 * (d_in[f - nx * ny] - 2 * d_in[f] + d_in[f + nx * ny]));
+                        sum += r_f;
+                        sum_sq += r_f * r_f;
+                    }
+                    d_out[IX(i, j, k, Nx, Ny)] = 0.125 * sum;
+                }
+            }
+        }
+
+        // wait for reduction
+#pragma acc wait
+    }// end data region
+
+    if (res_norm != nullptr) {
+        *res_norm = sqrt(sum_sq);
+    }
+}
+
 //================================== Prolongate ===============================
 // *****************************************************************************
 /// \brief  Prolongates field from coarse grid to fine grid (trilinear interpolation)
@@ -822,7 +1494,7 @@ void VCycleMG::Restrict(Field *out, Field *in, size_t level, bool sync) {
 /// \param  level       Multigrid level
 /// \param  sync        synchronization boolean (true=sync (default), false=async)
 // *****************************************************************************
-void VCycleMG::Prolongate(Field *out, Field *in, size_t level, bool sync) {
+void VCycleMG::Prolongate(FieldLP *out, FieldLP *in, size_t level, bool sync) {
     auto domain = Domain::getInstance();
 
     // local variables and parameters for GPU
@@ -842,42 +1514,84 @@ void VCycleMG::Prolongate(Field *out, Field *in, size_t level, bool sync) {
 
     auto boundary = BoundaryController::getInstance();
 
-    size_t *d_iList = boundary->get_innerList_level_joined();
+    size_t *d_rStart = boundary->get_innerRuns_start_level_joined();
+    size_t *d_rLen = boundary->get_innerRuns_length_level_joined();
 
     // start/end (going backwards)
-    // inner
-    size_t start_i = boundary->get_innerList_level_joined_start(level);
-    size_t end_i = boundary->get_innerList_level_joined_end(level) + 1;
+    // inner runs
+    size_t start_r = boundary->get_innerRuns_level_joined_start(level);
+    size_t end_r = boundary->get_innerRuns_level_joined_end(level) + 1;
 
     // prolongate
-    size_t i, j, k;
-
-#pragma acc data present(d_in[:bsize_in], d_out[:bsize_out], d_iList[start_i:(end_i-start_i)])
+#pragma acc data present(d_in[:bsize_in], d_out[:bsize_out], d_rStart[start_r:(end_r-start_r)], d_rLen[start_r:(end_r-start_r)])
     {
-#pragma acc kernels async
+        if (!boundary->hasObstacles()) {
+            // inner cells form a dense box, iterate structured without index list
+            const size_t i1 = domain->get_index_x1(level);
+            const size_t i2 = domain->get_index_x2(level);
+            const size_t j1 = domain->get_index_y1(level);
+            const size_t j2 = domain->get_index_y2(level);
+            const size_t k1 = domain->get_index_z1(level);
+            const size_t k2 = domain->get_index_z2(level);
+
+#pragma omp parallel for collapse(2)
+#pragma acc parallel loop independent collapse(3) async
+            for (size_t k = k1; k <= k2; ++k) {
+                for (size_t j = j1; j <= j2; ++j) {
+                    for (size_t i = i1; i <= i2; ++i) {
+                        const size_t idx = IX(i, j, k, Nx, Ny);
+
+                        d_out[IX(2 * i, 2 * j, 2 * k, nx, ny)] = 0.015625 * (27 * d_in[idx] + 9 * d_in[idx + 1] + 9 * d_in[idx + Nx] + 9 * d_in[idx + Nx * Ny]\
+ + 3 * d_in[idx + 1 + Nx] + 3 * d_in[idx + 1 + Nx * Ny] + 3 * d_in[idx + Nx + Nx * Ny] + d_in[idx + 1 + Nx + Nx * Ny]);
+                        d_out[IX(2 * i, 2 * j, 2 * k - 1, nx, ny)] = 0.015625 * (27 * d_in[idx] + 9 * d_in[idx + 1] + 9 * d_in[idx + Nx] + 9 * d_in[idx - Nx * Ny]\
+ + 3 * d_in[idx + 1 + Nx] + 3 * d_in[idx + 1 - Nx * Ny] + 3 * d_in[idx + Nx - Nx * Ny] + d_in[idx + 1 + Nx - Nx * Ny]);
+                        d_out[IX(2 * i, 2 * j - 1, 2 * k, nx, ny)] = 0.015625 * (27 * d_in[idx] + 9 * d_in[idx + 1] + 9 * d_in[idx - Nx] + 9 * d_in[idx + Nx * Ny]\
+ + 3 * d_in[idx + 1 - Nx] + 3 * d_in[idx + 1 + Nx * Ny] + 3 * d_in[idx - Nx + Nx * Ny] + d_in[idx + 1 - Nx + Nx * Ny]);
+                        d_out[IX(2 * i, 2 * j - 1, 2 * k - 1, nx, ny)] = 0.015625 * (27 * d_in[idx] + 9 * d_in[idx + 1] + 9 * d_in[idx - Nx] + 9 * d_in[idx - Nx * Ny]\
+ + 3 * d_in[idx + 1 - Nx] + 3 * d_in[idx + 1 - Nx * Ny] + 3 * d_in[idx - Nx - Nx * Ny] + d_in[idx + 1 - Nx - Nx * Ny]);
+                        d_out[IX(2 * i - 1, 2 * j, 2 * k, nx, ny)] = 0.015625 * (27 * d_in[idx] + 9 * d_in[idx - 1] + 9 * d_in[idx + Nx] + 9 * d_in[idx + Nx * Ny]\
+ + 3 * d_in[idx - 1 + Nx] + 3 * d_in[idx - 1 + Nx * Ny] + 3 * d_in[idx + Nx + Nx * Ny] + d_in[idx - 1 + Nx + Nx * Ny]);
+                        d_out[IX(2 * i - 1, 2 * j, 2 * k - 1, nx, ny)] = 0.015625 * (27 * d_in[idx] + 9 * d_in[idx - 1] + 9 * d_in[idx + Nx] + 9 * d_in[idx - Nx * Ny]\
+ + 3 * d_in[idx - 1 + Nx] + 3 * d_in[idx - 1 - Nx * Ny] + 3 * d_in[idx + Nx - Nx * Ny] + d_in[idx - 1 + Nx - Nx * Ny]);
+                        d_out[IX(2 * i - 1, 2 * j - 1, 2 * k, nx, ny)] = 0.015625 * (27 * d_in[idx] + 9 * d_in[idx - 1] + 9 * d_in[idx - Nx] + 9 * d_in[idx + Nx * Ny]\
+ + 3 * d_in[idx - 1 - Nx] + 3 * d_in[idx - 1 + Nx * Ny] + 3 * d_in[idx - Nx + Nx * Ny] + d_in[idx - 1 - Nx + Nx * Ny]);
+                        d_out[IX(2 * i - 1, 2 * j - 1, 2 * k - 1, nx, ny)] = 0.015625 * (27 * d_in[idx] + 9 * d_in[idx - 1] + 9 * d_in[idx - Nx] + 9 * d_in[idx - Nx * Ny]\
+ + 3 * d_in[idx - 1 - Nx] + 3 * d_in[idx - 1 - Nx * Ny] + 3 * d_in[idx - Nx - Nx * Ny] + d_in[idx - 1 - Nx - Nx * Ny]);
+                    }
+                }
+            }
+        } else {
+            // inner cells as runs of consecutive indices, a run never leaves its row (j, k)
+#pragma omp parallel for
+#pragma acc parallel loop independent async
+            for (size_t r = start_r; r < end_r; ++r) {
+                const size_t first = d_rStart[r];
+                const size_t k = first / (Nx * Ny);
+                const size_t j = (first - k * Nx * Ny) / Nx;
+                const size_t i_first = first - k * Nx * Ny - j * Nx;
+                const size_t i_last = i_first + d_rLen[r];
 #pragma acc loop independent
-        for (size_t l = start_i; l < end_i; ++l) {
-            const size_t idx = d_iList[l];
-            k = idx / (Nx * Ny);
-            j = (idx - k * Nx * Ny) / Nx;
-            i = idx - k * Nx * Ny - j * Nx;
+                for (size_t i = i_first; i < i_last; ++i) {
+                    const size_t idx = IX(i, j, k, Nx, Ny);
 
-            d_out[IX(2 * i, 2 * j, 2 * k, nx, ny)] = 0.015625 * (27 * d_in[idx] + 9 * d_in[idx + 1] + 9 * d_in[idx + Nx] + 9 * d_in[idx + Nx * Ny]\
+                    d_out[IX(2 * i, 2 * j, 2 * k, nx, ny)] = 0.015625 * (27 * d_in[idx] + 9 * d_in[idx + 1] + 9 * d_in[idx + Nx] + 9 * d_in[idx + Nx * Ny]\
  + 3 * d_in[idx + 1 + Nx] + 3 * d_in[idx + 1 + Nx * Ny] + 3 * d_in[idx + Nx + Nx * Ny] + d_in[idx + 1 + Nx + Nx * Ny]);
-            d_out[IX(2 * i, 2 * j, 2 * k - 1, nx, ny)] = 0.015625 * (27 * d_in[idx] + 9 * d_in[idx + 1] + 9 * d_in[idx + Nx] + 9 * d_in[idx - Nx * Ny]\
+                    d_out[IX(2 * i, 2 * j, 2 * k - 1, nx, ny)] = 0.015625 * (27 * d_in[idx] + 9 * d_in[idx + 1] + 9 * d_in[idx + Nx] + 9 * d_in[idx - Nx * Ny]\
  + 3 * d_in[idx + 1 + Nx] + 3 * d_in[idx + 1 - Nx * Ny] + 3 * d_in[idx + Nx - Nx * Ny] + d_in[idx + 1 + Nx - Nx * Ny]);
-            d_out[IX(2 * i, 2 * j - 1, 2 * k, nx, ny)] = 0.015625 * (27 * d_in[idx] + 9 * d_in[idx + 1] + 9 * d_in[idx - Nx] + 9 * d_in[idx + Nx * Ny]\
+                    d_out[IX(2 * i, 2 * j - 1, 2 * k, nx, ny)] = 0.015625 * (27 * d_in[idx] + 9 * d_in[idx + 1] + 9 * d_in[idx - Nx] + 9 * d_in[idx + Nx * Ny]\
  + 3 * d_in[idx + 1 - Nx] + 3 * d_in[idx + 1 + Nx * Ny] + 3 * d_in[idx - Nx + Nx * Ny] + d_in[idx + 1 - Nx + Nx * Ny]);
-            d_out[IX(2 * i, 2 * j - 1, 2 * k - 1, nx, ny)] = 0.015625 * (27 * d_in[idx] + 9 * d_in[idx + 1] + 9 * d_in[idx - Nx] + 9 * d_in[idx - Nx * Ny]\
+                    d_out[IX(2 * i, 2 * j - 1, 2 * k - 1, nx, ny)] = 0.015625 * (27 * d_in[idx] + 9 * d_in[idx + 1] + 9 * d_in[idx - Nx] + 9 * d_in[idx - Nx * Ny]\
  + 3 * d_in[idx + 1 - Nx] + 3 * d_in[idx + 1 - Nx * Ny] + 3 * d_in[idx - Nx - Nx * Ny] + d_in[idx + 1 - Nx - Nx * Ny]);
-            d_out[IX(2 * i - 1, 2 * j, 2 * k, nx, ny)] = 0.015625 * (27 * d_in[idx] + 9 * d_in[idx - 1] + 9 * d_in[idx + Nx] + 9 * d_in[idx + Nx * Ny]\
+                    d_out[IX(2 * i - 1, 2 * j, 2 * k, nx, ny)] = 0.015625 * (27 * d_in[idx] + 9 * d_in[idx - 1] + 9 * d_in[idx + Nx] + 9 * d_in[idx + Nx * Ny]\
  + 3 * d_in[idx - 1 + Nx] + 3 * d_in[idx - 1 + Nx * Ny] + 3 * d_in[idx + Nx + Nx * Ny] + d_in[idx - 1 + Nx + Nx * Ny]);
-            d_out[IX(2 * i - 1, 2 * j, 2 * k - 1, nx, ny)] = 0.015625 * (27 * d_in[idx] + 9 * d_in[idx - 1] + 9 * d_in[idx + Nx] + 9 * d_in[idx - Nx * Ny]\
+                    d_out[IX(2 * i - 1, 2 * j, 2 * k - 1, nx, ny)] = 0.015625 * (27 * d_in[idx] + 9 * d_in[idx - 1] + 9 * d_in[idx + Nx] + 9 * d_in[idx - Nx * Ny]\
  + 3 * d_in[idx - 1 + Nx] + 3 * d_in[idx - 1 - Nx * Ny] + 3 * d_in[idx + Nx - Nx * Ny] + d_in[idx - 1 + Nx - Nx * Ny]);
-            d_out[IX(2 * i - 1, 2 * j - 1, 2 * k, nx, ny)] = 0.015625 * (27 * d_in[idx] + 9 * d_in[idx - 1] + 9 * d_in[idx - Nx] + 9 * d_in[idx + Nx * Ny]\
+                    d_out[IX(2 * i - 1, 2 * j - 1, 2 * k, nx, ny)] = 0.015625 * (27 * d_in[idx] + 9 * d_in[idx - 1] + 9 * d_in[idx - Nx] + 9 * d_in[idx + Nx * Ny]\
  + 3 * d_in[idx - 1 - Nx] + 3 * d_in[idx - 1 + Nx * Ny] + 3 * d_in[idx - Nx + Nx * Ny] + d_in[idx - 1 - Nx + Nx * Ny]);
-            d_out[IX(2 * i - 1, 2 * j - 1, 2 * k - 1, nx, ny)] = 0.015625 * (27 * d_in[idx] + 9 * d_in[idx - 1] + 9 * d_in[idx - Nx] + 9 * d_in[idx - Nx * Ny]\
+                    d_out[IX(2 * i - 1, 2 * j - 1, 2 * k - 1, nx, ny)] = 0.015625 * (27 * d_in[idx] + 9 * d_in[idx - 1] + 9 * d_in[idx - Nx] + 9 * d_in[idx - Nx * Ny]\
  + 3 * d_in[idx - 1 - Nx] + 3 * d_in[idx - 1 - Nx * Ny] + 3 * d_in[idx - Nx - Nx * Ny] + d_in[idx - 1 - Nx - Nx * Ny]);
+                }
+            }
         }
 
         if (sync) {
@@ -895,7 +1609,8 @@ void VCycleMG::Prolongate(Field *out, Field *in, size_t level, bool sync) {
 /// \param  level       Multigrid level
 /// \param  sync        synchronization boolean (true=sync (default), false=async)
 // *****************************************************************************
-void VCycleMG::Solve(Field *out, Field *tmp, Field *b, size_t level, bool sync) {
+template<typename T>
+void VCycleMG::Solve(FieldT<T> *out, FieldT<T> *tmp, FieldT<T> *b, size_t level, bool sync) {
     auto domain = Domain::getInstance();
 
     // local variables and parameters for GPU
@@ -948,7 +1663,7 @@ void VCycleMG::Solve(Field *out, Field *tmp, Field *b, size_t level, bool sync)
     size_t start_b = boundary->get_boundaryList_level_joined_start(level);
     size_t end_b = boundary->get_boundaryList_level_joined_end(level) + 1;
 
-    boundary->applyBoundary(d_out, level, type, sync);
+    ApplyBoundary(d_out, level, type, sync);
 
     const real rdx2 = 1. / (dx * dx);
     const real rdy2 = 1. / (dy * dy);
@@ -966,6 +1681,7 @@ void VCycleMG::Solve(Field *out, Field *tmp, Field *b, size_t level, bool sync)
     {
         // initialization
         // inner
+#pragma omp parallel for
 #pragma acc kernels present(d_iList[start_i:(end_i-start_i)]) async
 #pragma acc loop independent
         for (size_t j = start_i; j < end_i; ++j) {
@@ -974,6 +1690,7 @@ void VCycleMG::Solve(Field *out, Field *tmp, Field *b, size_t level, bool sync)
         }
 
         // boundary
+#pragma omp parallel for
 #pragma acc kernels present(d_bList[start_b:(end_b-start_b)]) async
 #pragma acc loop independent
         for (size_t j = start_b; j < end_b; ++j) {
@@ -995,17 +1712,18 @@ void VCycleMG::Solve(Field *out, Field *tmp, Field *b, size_t level, bool sync)
 
             while (res > tol_res && it < max_it) {
                 JacobiDiffuse::JacobiStep(level, out, tmp, b, alphaX, alphaY, alphaZ, beta, m_dsign, m_w, sync);
-                boundary->applyBoundary(d_out, level, type, sync);
+                ApplyBoundary(d_out, level, type, sync);
 
                 sum = 0.;
 
-#pragma acc parallel loop independent present(d_out[:bsize], d_tmp[:bsize], d_iList[:bsize_i]) async
+#pragma omp parallel for reduction(+:sum)
+#pragma acc parallel loop independent present(d_out[:bsize], d_tmp[:bsize], d_iList[:bsize_i]) reduction(+:sum) async
                 for (size_t j = start_i; j < end_i; ++j) {
                     const size_t i = d_iList[j];
-                    res = d_b[i] - (rdx2 * (d_out[i - 1] - 2 * d_out[i] + d_out[i + 1])\
+                    const real res_i = d_b[i] - (rdx2 * (d_out[i - 1] - 2 * d_out[i] + d_out[i + 1])\
  + rdy2 * (d_out[i - Nx] - 2 * d_out[i] + d_out[i + Nx])\
  + rdz2 * (d_out[i - Nx * Ny] - 2 * d_out[i] + d_out[i + Nx * Ny])); //res = rbeta*(d_out[i] - d_tmp[i]);
-                    sum += res * res;
+                    sum += res_i * res_i;
                 }
                 // info: in nvvp profile 8byte size copy from to device to/from pageable due to sum!
 
@@ -1019,6 +1737,7 @@ void VCycleMG::Solve(Field *out, Field *tmp, Field *b, size_t level, bool sync)
             }  // end while
 
             if (it % 2 != 0) {  // swap necessary when odd number of iterations
+#pragma omp parallel for
 #pragma acc kernels present(d_out[:bsize], d_tmp[:bsize], d_iList[start_i:(end_i-start_i)]) async
 #pragma acc loop independent
                 // inner
@@ -1027,6 +1746,7 @@ void VCycleMG::Solve(Field *out, Field *tmp, Field *b, size_t level, bool sync)
                     d_out[i] = d_tmp[i];
                 }
                 // boundary
+#pragma omp parallel for
 #pragma acc kernels present(d_out[:bsize], d_tmp[:bsize], d_bList[start_b:(end_b-start_b)]) async
 #pragma acc loop independent
                 for (size_t j = start_b; j < end_b; ++j) {
@@ -1039,24 +1759,29 @@ void VCycleMG::Solve(Field *out, Field *tmp, Field *b, size_t level, bool sync)
 #pragma acc data present(d_out[:bsize], d_tmp[:bsize], d_b[:bsize])
         {
             size_t it = 0;
-            const size_t max_it = static_cast<size_t>(params->get_int("solver/diffusion/max_iter"));
-            const real tol_res = params->get_real("solver/diffusion/tol_res");
+            const size_t max_it = static_cast<size_t>(params->get_int("solver/pressure/diffusion/max_solve"));
+            const real tol_res = params->get_real("solver/pressure/diffusion/tol_res");
             real sum;
             real res = 10000.;
 
             while (res > tol_res && it < max_it) {
-                ColoredGaussSeidelDiffuse::colored_gauss_seidel_step(out, b, alphaX, alphaY, alphaZ, beta, m_dsign, m_w, sync);
-                boundary->applyBoundary(d_out, level, type, sync); // for res/err only Dirichlet BC
+                if (m_row_split) {
+                    ColoredGaussSeidelDiffuse::red_black_step(out, b, alphaX, alphaY, alphaZ, beta, m_dsign, m_w, sync);
+                } else {
+                    ColoredGaussSeidelDiffuse::colored_gauss_seidel_step(out, b, alphaX, alphaY, alphaZ, beta, m_dsign, m_w, sync);
+                }
+                ApplyBoundary(d_out, level, type, sync); // for res/err only Dirichlet BC
 
                 sum = 0.;
 
-#pragma acc parallel loop independent present(d_out[:bsize], d_tmp[:bsize], d_iList[:bsize_i]) async
+#pragma omp parallel for reduction(+:sum)
+#pragma acc parallel loop independent present(d_out[:bsize], d_tmp[:bsize], d_iList[:bsize_i]) reduction(+:sum) async
                 for (size_t j = start_i; j < end_i; ++j) {
                     const size_t i = d_iList[j];
-                    res = d_b[i] - (rdx2 * (d_out[i - 1] - 2 * d_out[i] + d_out[i + 1])\
+                    const real res_i = d_b[i] - (rdx2 * (d_out[i - 1] - 2 * d_out[i] + d_out[i + 1])\
  + rdy2 * (d_out[i - Nx] - 2 * d_out[i] + d_out[i + Nx])\
  + rdz2 * (d_out[i - Nx * Ny] - 2 * d_out[i] + d_out[i + Nx * Ny])); //res = rbeta*(d_out[i] - d_tmp[i]);
-                    sum += res * res;
+                    sum += res_i * res_i;
                 }
                 // info: in nvvp profile 8byte size copy from to device to/from pageable due to sum!
 
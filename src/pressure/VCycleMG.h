@@ -7,6 +7,7 @@
 #ifndef ARTSS_PRESSURE_VCYCLEMG_H_
 #define ARTSS_PRESSURE_VCYCLEMG_H_
 
+#include <fstream>
 #include <vector>
 #include "../interfaces/IPressure.h"
 #include "../field/Field.h"
@@ -21,15 +22,37 @@ public:
     ~VCycleMG() override;
 
     void pressure(Field* out, Field* b, real t, bool sync);
+    void Precondition(Field* out, Field* b, bool sync = true);
 
 private:
-    void VCycleMultigrid(Field* out, bool sync = true);
+    enum CycleType : int {
+        V_CYCLE = 0, W_CYCLE = 1, F_CYCLE = 2
+    };
+
+    template<typename T>
+    void ApplyBoundary(T* d, size_t level, FieldType type, bool sync = true);
+    void FullMultigrid(Field* out, bool sync = true);
+    void VCycleMultigrid(Field* out, bool sync = true, real* res_norm = nullptr);
+    void Cycle(Field* out, size_t level, CycleType type, bool sync = true, real* res_norm = nullptr);
+    template<typename T>
+    void CycleDown(FieldT<T>* sol, FieldT<T>* tmp, FieldT<T>* b, size_t level, bool sync = true, real* res_norm = nullptr);
+    template<typename T>
+    void CycleUp(FieldT<T>* sol, FieldT<T>* tmp, FieldT<T>* b, size_t level, bool sync = true);
+    template<typename T>
+    void Correct(FieldT<T>* out, FieldLP* err, size_t level, bool replace, bool sync = true);
     void UpdateInput(Field* out, Field* b, bool sync = true);
-    void Smooth(Field* out, Field* tmp, Field* b, size_t level, bool sync = true);
-    void Residuum(Field* out, Field* in, Field* b, size_t level, bool sync = true);
-    void Restrict(Field* out, Field* in, size_t level, bool sync = true);
-    void Prolongate(Field* out, Field* in, size_t level, bool sync = true);
-    void Solve( Field* out, Field* tmp, Field* b, size_t level, bool sync = true);
+    template<typename T>
+    void Smooth(FieldT<T>* out, FieldT<T>* tmp, FieldT<T>* b, size_t level, bool sync = true);
+    void SmoothWavefront(Field* out, Field* b, size_t level, bool sync = true);
+    template<typename T>
+    void Residuum(FieldLP* out, FieldT<T>* in, FieldT<T>* b, size_t level, bool sync = true, real* res_norm = nullptr);
+    template<typename T>
+    void Restrict(FieldLP* out, FieldT<T>* in, size_t level, bool sync = true);
+    template<typename T>
+    void ResiduumRestrict(FieldLP* out, FieldT<T>* in, FieldT<T>* b, size_t level, bool sync = true, real* res_norm = nullptr);
+    void Prolongate(FieldLP* out, FieldLP* in, size_t level, bool sync = true);
+    template<typename T>
+    void Solve(FieldT<T>* out, FieldT<T>* tmp, FieldT<T>* b, size_t level, bool sync = true);
 
     int levels;
     int cycles;
@@ -38,11 +61,29 @@ private:
     real m_dsign;
     real m_w;
 
-    std::vector<Field*> residuum0;
-    std::vector<Field*> residuum1;
-    std::vector<Field*> err0;
-    std::vector<Field*> error1;
-    std::vector<Field*> mg_temporal_solution;
+    CycleType m_cycle_type;
+    bool m_full_multigrid;
+    size_t m_inner_size;
+
+    bool m_fused_restriction;
+    bool m_adaptive_cycles;
+    int m_max_cycles;
+    real m_tol_res;
+    std::ofstream m_cycles_csv;
+    bool m_wavefront_smooth;
+    std::vector<real> m_wavefront_planes;
+    bool m_row_split;
+    bool m_homogeneous = false;  // set while preconditioning
+
+    // finest level in full precision
+    Field* m_b0;    // rhs
+    Field* m_tmp0;  // temporary solution for smoothing
+    // levels (residuum1, error1 and mg_temporal_solution from level 1 on)
+    std::vector<FieldLP*> residuum0;
+    std::vector<FieldLP*> residuum1;
+    std::vector<FieldLP*> err0;
+    std::vector<FieldLP*> error1;
+    std::vector<FieldLP*> mg_temporal_solution;
 #ifndef BENCHMARKING
     std::shared_ptr<spdlog::logger> m_logger;
 #endif
@@ -9,6 +9,7 @@
 #include "../Domain.h"
 #include "SolverSelection.h"
 #include "../utility/Utility.h"
+#include "../utility/Profiler.h"
 
 
 AdvectionDiffusionSolver::AdvectionDiffusionSolver(FieldController *field_controller) {
@@ -70,17 +71,17 @@ void AdvectionDiffusionSolver::do_step(real t, bool sync) {
 #pragma acc data present(d_u[:bsize], d_u0[:bsize], d_u_tmp[:bsize], d_v[:bsize], d_v0[:bsize], d_v_tmp[:bsize], d_w[:bsize], d_w0[:bsize], d_w_tmp[:bsize])
     {
 // 1. Solve advection equation
+        Profiler::Scope stage(Stage::ADVECTION);
 #ifndef BENCHMARKING
         m_logger->info("Advect ...");
 #endif
-        adv->advect(u, u0, u0, v0, w0, sync);
-        adv->advect(v, v0, u0, v0, w0, sync);
-        adv->advect(w, w0, u0, v0, w0, sync);
+        adv->advect_vector(u, v, w, u0, v0, w0, u0, v0, w0, sync);
 
 // 2. Couple data to prepare for diffusion
         FieldController::couple_vector(u, u0, u_tmp, v, v0, v_tmp, w, w0, w_tmp, sync);
 
 // 3. Solve diffusion equation
+        stage.enter(Stage::DIFFUSION);
         if (nu != 0.) {
 #ifndef BENCHMARKING
             m_logger->info("Diffuse ...");
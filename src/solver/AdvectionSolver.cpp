@@ -9,6 +9,7 @@
 #include "../utility/Parameters.h"
 #include "../Domain.h"
 #include "SolverSelection.h"
+#include "../utility/Profiler.h"
 
 AdvectionSolver::AdvectionSolver(FieldController *field_controlller) {
 #ifndef BENCHMARKING
@@ -93,12 +94,11 @@ void AdvectionSolver::do_step(real t, bool sync) {
 #pragma acc data present(d_u_lin[:bsize], d_v_lin[:bsize], d_w_lin[:bsize], d_u[:bsize], d_u0[:bsize], d_v[:bsize], d_v0[:bsize], d_w[:bsize], d_w0[:bsize])
     {
 // 1. Solve advection equation
+        Profiler::Scope stage(Stage::ADVECTION);
 #ifndef BENCHMARKING
         m_logger->info("Advect ...");
 #endif
-        adv->advect(u, u0, u_lin, v_lin, w_lin, sync);
-        adv->advect(v, v0, u_lin, v_lin, w_lin, sync);
-        adv->advect(w, w0, u_lin, v_lin, w_lin, sync);
+        adv->advect_vector(u, v, w, u0, v0, w0, u_lin, v_lin, w_lin, sync);
     }//end data
 }
 
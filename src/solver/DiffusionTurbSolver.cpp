@@ -5,6 +5,7 @@
 /// \copyright  <2015-2020> Forschungszentrum Juelich GmbH. All rights reserved.
 
 #include "DiffusionTurbSolver.h"
+#include "../utility/Profiler.h"
 
 DiffusionTurbSolver::DiffusionTurbSolver(FieldController *field_controller) {
 #ifndef BENCHMARKING
@@ -69,10 +70,12 @@ void DiffusionTurbSolver::do_step(real t, bool sync) {
 
 #pragma acc data present(d_u[:bsize], d_u0[:bsize], d_u_tmp[:bsize], d_v[:bsize], d_v0[:bsize], d_v_tmp[:bsize], d_w[:bsize], d_w0[:bsize], d_w_tmp[:bsize], d_nu_t[:bsize]) //EV
     {
+        Profiler::Scope stage(Stage::TURBULENCE);
 #ifndef BENCHMARKING
         m_logger->info("Calculating Turbulent viscosity ...");
 #endif
         mu_tub->CalcTurbViscosity(nu_t, u, v, w, true);
+        stage.enter(Stage::DIFFUSION);
 #ifndef BENCHMARKING
         m_logger->info("Diffuse ...");
 #endif
@@ -10,6 +10,7 @@
 #include "../Domain.h"
 #include "SolverSelection.h"
 #include "../boundary/BoundaryData.h"
+#include "../utility/Profiler.h"
 
 NSSolver::NSSolver(FieldController *field_controller) {
 #ifndef BENCHMARKING
@@ -95,18 +96,18 @@ void NSSolver::do_step(real t, bool sync) {
 #pragma acc data present(d_u[:bsize], d_u0[:bsize], d_u_tmp[:bsize], d_v[:bsize], d_v0[:bsize], d_v_tmp[:bsize], d_w[:bsize], d_w0[:bsize], d_w_tmp[:bsize], d_p[:bsize], d_p0[:bsize], d_rhs[:bsize], d_fx[:bsize], d_fy[:bsize], d_fz[:bsize])
     {
 // 1. Solve advection equation
+        Profiler::Scope stage(Stage::ADVECTION);
 #ifndef BENCHMARKING
         m_logger->info("Advect ...");
 #endif
-        adv_vel->advect(u, u0, u0, v0, w0, sync);
-        adv_vel->advect(v, v0, u0, v0, w0, sync);
-        adv_vel->advect(w, w0, u0, v0, w0, sync);
+        adv_vel->advect_vector(u, v, w, u0, v0, w0, u0, v0, w0, sync);
 
 
 // Couple velocity to prepare for diffusion
         FieldController::couple_vector(u, u0, u_tmp, v, v0, v_tmp, w, w0, w_tmp, sync);
 
 // 2. Solve diffusion equation
+        stage.enter(Stage::DIFFUSION);
         if (nu != 0.) {
 #ifndef BENCHMARKING
             m_logger->info("Diffuse ...");
@@ -114,35 +115,38 @@ void NSSolver::do_step(real t, bool sync) {
             dif_vel->diffuse(u, u0, u_tmp, nu, sync);
             dif_vel->diffuse(v, v0, v_tmp, nu, sync);
             dif_vel->diffuse(w, w0, w_tmp, nu, sync);
-
-            // Couple data to prepare for adding source
-            FieldController::couple_vector(u, u0, u_tmp, v, v0, v_tmp, w, w0, w_tmp, sync);
         }
 
 // 3. Add force
+        stage.enter(Stage::SOURCE);
         if (m_sourceFct != SourceMethods::Zero) {
 #ifndef BENCHMARKING
             m_logger->info("Add source ...");
 #endif
             sou->add_source(u, v, w, f_x, f_y, f_z, sync);
-            // Couple data
-            FieldController::couple_vector(u, u0, u_tmp, v, v0, v_tmp, w, w0, w_tmp, sync);
         }
 
+        // Hand velocity over to the projection (u_tmp takes the buffer of u, u0 is coupled in update_data)
+        FieldController::rotate_vector(u, u_tmp, v, v_tmp, w, w_tmp, sync);
+
 // 4. Solve pressure equation and project
         // Calculate divergence of u
+        stage.enter(Stage::DIVERGENCE);
         pres->divergence(rhs, u_tmp, v_tmp, w_tmp, sync);
 
         // Solve pressure equation
+        stage.enter(Stage::PRESSURE);
 #ifndef BENCHMARKING
         m_logger->info("Pressure ...");
 #endif
         pres->pressure(p, rhs, t, sync);
 
         // Correct
+        stage.enter(Stage::PROJECTION);
         pres->projection(u, v, w, u_tmp, v_tmp, w_tmp, p, sync);
 
 // 5. Sources updated in Solver::update_sources, TimeIntegration
+        stage.stop();
 
         if (sync) {
 #pragma acc wait
@@ -10,6 +10,7 @@
 #include "../Domain.h"
 #include "SolverSelection.h"
 #include "../boundary/BoundaryData.h"
+#include "../utility/Profiler.h"
 
 NSTempSolver::NSTempSolver(FieldController *field_controller) {
 #ifndef BENCHMARKING
@@ -125,18 +126,18 @@ void NSTempSolver::do_step(real t, bool sync) {
                             d_fx[:bsize], d_fy[:bsize], d_fz[:bsize], d_S_T[:bsize])
     {
 // 1. Solve advection equation
+        Profiler::Scope stage(Stage::ADVECTION);
 #ifndef BENCHMARKING
         m_logger->info("Advect ...");
 #endif
-        adv_vel->advect(u, u0, u0, v0, w0, sync);
-        adv_vel->advect(v, v0, u0, v0, w0, sync);
-        adv_vel->advect(w, w0, u0, v0, w0, sync);
+        adv_vel->advect_vector(u, v, w, u0, v0, w0, u0, v0, w0, sync);
 
 
         // Couple velocity to prepare for diffusion
         FieldController::couple_vector(u, u0, u_tmp, v, v0, v_tmp, w, w0, w_tmp, sync);
 
 // 2. Solve diffusion equation
+        stage.enter(Stage::DIFFUSION);
         if (nu != 0.) {
 #ifndef BENCHMARKING
             m_logger->info("Diffuse ...");
@@ -144,67 +145,66 @@ void NSTempSolver::do_step(real t, bool sync) {
             dif_vel->diffuse(u, u0, u_tmp, nu, sync);
             dif_vel->diffuse(v, v0, v_tmp, nu, sync);
             dif_vel->diffuse(w, w0, w_tmp, nu, sync);
-
-            // Couple data to prepare for adding source
-            FieldController::couple_vector(u, u0, u_tmp, v, v0, v_tmp, w, w0, w_tmp, sync);
         }
 
 // 3. Add force
+        stage.enter(Stage::SOURCE);
         if (m_forceFct != SourceMethods::Zero) {
 #ifndef BENCHMARKING
             m_logger->info("Add momentum source ...");
 #endif
             sou_vel->add_source(u, v, w, f_x, f_y, f_z, sync);
-
-            // Couple data to prepare for adding source
-            FieldController::couple_vector(u, u0, u_tmp, v, v0, v_tmp, w, w0, w_tmp, sync);
         }
 
+        // Hand velocity over to the projection (u_tmp takes the buffer of u, u0 is coupled in update_data)
+        FieldController::rotate_vector(u, u_tmp, v, v_tmp, w, w_tmp, sync);
+
 // 4. Solve pressure equation and project
         // Calculate divergence of u
+        stage.enter(Stage::DIVERGENCE);
         pres->divergence(rhs, u_tmp, v_tmp, w_tmp, sync);
 
         // Solve pressure equation
+        stage.enter(Stage::PRESSURE);
 #ifndef BENCHMARKING
         m_logger->info("Pressure ...");
 #endif
         pres->pressure(p, rhs, t, sync);        //only multigrid cycle, divergence and velocity update (in case of NS) need to be added
 
         // Correct
+        stage.enter(Stage::PROJECTION);
         pres->projection(u, v, w, u_tmp, v_tmp, w_tmp, p, sync);
 
 // 5. Solve Temperature and link back to force
         // Solve advection equation
+        stage.enter(Stage::ADVECTION);
 #ifndef BENCHMARKING
         m_logger->info("Advect Temperature ...");
 #endif
         adv_temp->advect(T, T0, u, v, w, sync);
 
-        // Couple temperature to prepare for diffusion
+        // Couple temperature to prepare for diffusion (diffusion, dissipation and source update T only,
+        // T0 and T_tmp are not read anymore in this step and coupled again in update_data)
         FieldController::couple_scalar(T, T0, T_tmp, sync);
 
         // Solve diffusion equation
+        stage.enter(Stage::DIFFUSION);
         if (kappa != 0.) {
 
 #ifndef BENCHMARKING
             m_logger->info("Diffuse Temperature ...");
 #endif
             dif_temp->diffuse(T, T0, T_tmp, kappa, sync);
-
-            // Couple temperature to prepare for adding source
-            FieldController::couple_scalar(T, T0, T_tmp, sync);
         }
 
         // Add dissipation
+        stage.enter(Stage::SOURCE);
         if (m_has_dissipation) {
 
 #ifndef BENCHMARKING
             m_logger->info("Add dissipation ...");
 #endif
             sou_temp->dissipate(T, u, v, w, sync);
-
-            // Couple temperature
-            FieldController::couple_scalar(T, T0, T_tmp, sync);
         }
 
         // Add source
@@ -214,12 +214,10 @@ void NSTempSolver::do_step(real t, bool sync) {
             m_logger->info("Add temperature source ...");
 #endif
             sou_temp->add_source(T, S_T, sync);
-
-            // Couple temperature
-            FieldController::couple_scalar(T, T0, T_tmp, sync);
         }
 
 // 6. Sources updated in Solver::update_sources, TimeIntegration
+        stage.stop();
 
         if (sync) {
 #pragma acc wait
@@ -10,6 +10,7 @@
 #include "../Domain.h"
 #include "SolverSelection.h"
 #include "../boundary/BoundaryData.h"
+#include "../utility/Profiler.h"
 
 NSTempTurbConSolver::NSTempTurbConSolver(FieldController *field_controller) {
 #ifndef BENCHMARKING
@@ -66,6 +67,20 @@ NSTempTurbConSolver::NSTempTurbConSolver(FieldController *field_controller) {
     m_forceFct = params->get("solver/source/force_fct");
     m_tempFct = params->get("solver/temperature/source/temp_fct");
     m_conFct = params->get("solver/concentration/source/con_fct");
+    if (m_has_turbulence_temperature) {
+        m_rPr_T = 1. / params->get_real("solver/temperature/turbulence/Pr_T");
+    }
+    if (m_has_turbulence_concentration) {
+        m_rSc_T = 1. / params->get_real("solver/concentration/turbulence/Sc_T");
+    }
+
+    // Transport of temperature and concentration on host threads (GPU builds use async queues)
+    m_task_pool = nullptr;
+#ifndef _OPENACC
+    if (params->get("solver/task_pool/enabled", "No") == "Yes") {
+        m_task_pool = new TaskPool(std::stoi(params->get("solver/task_pool/threads", "2")));
+    }
+#endif
     control();
 }
 
@@ -81,6 +96,7 @@ NSTempTurbConSolver::~NSTempTurbConSolver() {
     delete sou_vel;
     delete sou_temp;
     delete sou_con;
+    delete m_task_pool;
 }
 
 //====================================== do_step =================================
@@ -90,8 +106,6 @@ NSTempTurbConSolver::~NSTempTurbConSolver() {
 /// \param  sync        synchronization boolean (true=sync (default), false=async)
 // ***************************************************************************************
 void NSTempTurbConSolver::do_step(real t, bool sync) {
-    auto params = Parameters::getInstance();
-
     // local variables and parameters for GPU
     auto u = m_field_controller->field_u;
     auto v = m_field_controller->field_v;
@@ -150,8 +164,6 @@ void NSTempTurbConSolver::do_step(real t, bool sync) {
     size_t bsize = Domain::getInstance()->get_size(u->get_level());
 
     auto nu = m_nu;
-    auto kappa = m_kappa;
-    auto gamma = m_gamma;
     auto dir_vel = m_dir_vel;
 
 #pragma acc data present(    d_u[:bsize], d_u0[:bsize], d_u_tmp[:bsize], d_v[:bsize], d_v0[:bsize], d_v_tmp[:bsize], d_w[:bsize], \
@@ -160,21 +172,22 @@ void NSTempTurbConSolver::do_step(real t, bool sync) {
                             d_nu_t[:bsize], d_kappa_t[:bsize], d_gamma_t[:bsize])
     {
 // 1. Solve advection equation
+        Profiler::Scope stage(Stage::ADVECTION);
 #ifndef BENCHMARKING
         m_logger->info("Advect ...");
 #endif
-        adv_vel->advect(u, u0, u0, v0, w0, sync);
-        adv_vel->advect(v, v0, u0, v0, w0, sync);
-        adv_vel->advect(w, w0, u0, v0, w0, sync);
+        adv_vel->advect_vector(u, v, w, u0, v0, w0, u0, v0, w0, sync);
 
         // Couple velocity to prepare for diffusion
         FieldController::couple_vector(u, u0, u_tmp, v, v0, v_tmp, w, w0, w_tmp, sync);
 
 // 2. Solve turbulent diffusion equation
+        stage.enter(Stage::TURBULENCE);
 #ifndef BENCHMARKING
         m_logger->info("Calculating Turbulent viscosity ...");
 #endif
         mu_tub->CalcTurbViscosity(nu_t, u, v, w, true);
+        stage.enter(Stage::DIFFUSION);
 
 #ifndef BENCHMARKING
         m_logger->info("Diffuse ...");
@@ -183,158 +196,227 @@ void NSTempTurbConSolver::do_step(real t, bool sync) {
         dif_vel->diffuse(v, v0, v_tmp, nu, nu_t, sync);
         dif_vel->diffuse(w, w0, w_tmp, nu, nu_t, sync);
 
-        // Couple data to prepare for adding source
-        FieldController::couple_vector(u, u0, u_tmp, v, v0, v_tmp, w, w0, w_tmp, sync);
-
 // 3. Add force
+        stage.enter(Stage::SOURCE);
         if (m_forceFct != SourceMethods::Zero) {
 #ifndef BENCHMARKING
             m_logger->info("Add momentum source ...");
 #endif
             sou_vel->add_source(u, v, w, f_x, f_y, f_z, sync);
-
-            // Couple data to prepare for adding source
-            FieldController::couple_vector(u, u0, u_tmp, v, v0, v_tmp, w, w0, w_tmp, sync);
         }
 
+        // Hand velocity over to the projection (u_tmp takes the buffer of u, u0 is coupled in update_data)
+        FieldController::rotate_vector(u, u_tmp, v, v_tmp, w, w_tmp, sync);
+
 // 4. Solve pressure equation and project
         // Calculate divergence of u
+        stage.enter(Stage::DIVERGENCE);
         pres->divergence(rhs, u_tmp, v_tmp, w_tmp, sync);
 
         // Solve pressure equation
+        stage.enter(Stage::PRESSURE);
 #ifndef BENCHMARKING
         m_logger->info("Pressure ...");
 #endif
         pres->pressure(p, rhs, t, sync);
 
         // Correct
+        stage.enter(Stage::PROJECTION);
         pres->projection(u, v, w, u_tmp, v_tmp, w_tmp, p, sync);
 
-// 5. Solve Temperature and link back to force
+// 5./6. Solve temperature and concentration (independent of each other, both use the projected velocity)
+        stage.stop();
+        if (m_task_pool != nullptr) {
+            auto advect_T = m_task_pool->add_task([this, sync] { advect_temperature(sync); });
+            auto kappa_T = m_task_pool->add_task([this, sync] { calc_kappa_t(sync); });
+            m_task_pool->add_task([this, sync] { diffuse_temperature(sync); }, {advect_T, kappa_T});
+            auto advect_C = m_task_pool->add_task([this, sync] { advect_concentration(sync); });
+            auto gamma_C = m_task_pool->add_task([this, sync] { calc_gamma_t(sync); });
+            m_task_pool->add_task([this, sync] { diffuse_concentration(sync); }, {advect_C, gamma_C});
+            // T and C are read by TimeIntegration right after the step, hence always joined here
+            m_task_pool->run();
+        } else {
+            advect_temperature(sync);
+            calc_kappa_t(sync);
+            diffuse_temperature(sync);
+            advect_concentration(sync);
+            calc_gamma_t(sync);
+            diffuse_concentration(sync);
+        }
+
+// 7. Sources updated in Solver::update_sources, TimeIntegration
+
+        if (sync) {
+#pragma acc wait
+        }
+    }//end data
+}
+
+//====================================== Temperature =================================
+// ***************************************************************************************
+/// \brief  advects temperature and couples it to prepare for diffusion
+/// \param  sync        synchronization boolean (true=sync (default), false=async)
+// ***************************************************************************************
+void NSTempTurbConSolver::advect_temperature(bool sync) {
+    Profiler::Scope stage(Stage::ADVECTION);
+    auto T = m_field_controller->field_T;
+    auto T0 = m_field_controller->field_T0;
+    auto T_tmp = m_field_controller->field_T_tmp;
 
-        // Solve advection equation
 #ifndef BENCHMARKING
-        m_logger->info("Advect Temperature ...");
+    m_logger->info("Advect Temperature ...");
 #endif
-        adv_temp->advect(T, T0, u, v, w, sync);
+    adv_temp->advect(T, T0, m_field_controller->field_u, m_field_controller->field_v, m_field_controller->field_w, sync);
 
-        // Couple temperature to prepare for diffusion
-        FieldController::couple_scalar(T, T0, T_tmp, sync);
+    // Couple temperature to prepare for diffusion (diffusion, dissipation and source update T only,
+    // T0 and T_tmp are not read anymore in this step and coupled again in update_data)
+    FieldController::couple_scalar(T, T0, T_tmp, sync);
+}
 
-        // Solve diffusion equation
-        // turbulence
-        if (m_has_turbulence_temperature) {
-            real Pr_T = params->get_real("solver/temperature/turbulence/Pr_T");
-            real rPr_T = 1. / Pr_T;
+// ***************************************************************************************
+/// \brief  calculates eddy thermal diffusivity kappa_t = nu_t/Pr_t
+/// \param  sync        synchronization boolean (true=sync (default), false=async)
+// ***************************************************************************************
+void NSTempTurbConSolver::calc_kappa_t(bool) {
+    if (!m_has_turbulence_temperature) {
+        return;
+    }
+    Profiler::Scope stage(Stage::DIFFUSION);
+    auto d_kappa_t = m_field_controller->field_kappa_t->data;
+    auto d_nu_t = m_field_controller->field_nu_t->data;
+    size_t bsize = Domain::getInstance()->get_size(m_field_controller->field_kappa_t->get_level());
+    real rPr_T = m_rPr_T;
 
 #pragma acc parallel loop independent present(d_kappa_t[:bsize], d_nu_t[:bsize]) async
-            for (size_t i = 0; i < bsize; ++i) {
-                d_kappa_t[i] = d_nu_t[i] * rPr_T; // kappa_turb = nu_turb/Pr_turb
-            }
+    for (size_t i = 0; i < bsize; ++i) {
+        d_kappa_t[i] = d_nu_t[i] * rPr_T; // kappa_turb = nu_turb/Pr_turb
+    }
+}
 
+// ***************************************************************************************
+/// \brief  diffuses temperature and adds dissipation or source
+/// \param  sync        synchronization boolean (true=sync (default), false=async)
+// ***************************************************************************************
+void NSTempTurbConSolver::diffuse_temperature(bool sync) {
+    auto T = m_field_controller->field_T;
+    auto T0 = m_field_controller->field_T0;
+    auto T_tmp = m_field_controller->field_T_tmp;
+    auto kappa = m_kappa;
+
+    // Solve diffusion equation
+    Profiler::Scope stage(Stage::DIFFUSION);
+    // turbulence
+    if (m_has_turbulence_temperature) {
 #ifndef BENCHMARKING
-            m_logger->info("Diffuse turbulent Temperature ...");
+        m_logger->info("Diffuse turbulent Temperature ...");
 #endif
-            dif_temp->diffuse(T, T0, T_tmp, kappa, kappa_t, sync);
-
-            // Couple temperature to prepare for adding source
-            FieldController::couple_scalar(T, T0, T_tmp, sync);
-        } else {
-            // no turbulence
-            if (kappa != 0.) {
+        dif_temp->diffuse(T, T0, T_tmp, kappa, m_field_controller->field_kappa_t, sync);
+    } else {
+        // no turbulence
+        if (kappa != 0.) {
 
 #ifndef BENCHMARKING
-                m_logger->info("Diffuse Temperature ...");
+            m_logger->info("Diffuse Temperature ...");
 #endif
-                dif_temp->diffuse(T, T0, T_tmp, kappa, sync);
-
-                // Couple temperature to prepare for adding source
-                FieldController::couple_scalar(T, T0, T_tmp, sync);
-            }
+            dif_temp->diffuse(T, T0, T_tmp, kappa, sync);
         }
+    }
 
-        // Add dissipation
-        if (m_has_dissipation) {
+    // Add dissipation
+    stage.enter(Stage::SOURCE);
+    if (m_has_dissipation) {
 
 #ifndef BENCHMARKING
-            m_logger->info("Add dissipation ...");
+        m_logger->info("Add dissipation ...");
 #endif
-            sou_temp->dissipate(T, u, v, w, sync);
-
-            // Couple temperature
-            FieldController::couple_scalar(T, T0, T_tmp, sync);
-        }
+        sou_temp->dissipate(T, m_field_controller->field_u, m_field_controller->field_v, m_field_controller->field_w, sync);
+    }
 
-            // Add source
-        else if (m_tempFct != SourceMethods::Zero) {
+        // Add source
+    else if (m_tempFct != SourceMethods::Zero) {
 
 #ifndef BENCHMARKING
-            m_logger->info("Add temperature source ...");
+        m_logger->info("Add temperature source ...");
 #endif
-            sou_temp->add_source(T, S_T, sync);
-
-            // Couple temperature
-            FieldController::couple_scalar(T, T0, T_tmp, sync);
-        }
+        sou_temp->add_source(T, m_field_controller->field_source_T, sync);
+    }
+}
 
-// 6. Solve Concentration
+//====================================== Concentration ===============================
+// ***************************************************************************************
+/// \brief  advects concentration and couples it to prepare for diffusion
+/// \param  sync        synchronization boolean (true=sync (default), false=async)
+// ***************************************************************************************
+void NSTempTurbConSolver::advect_concentration(bool sync) {
+    Profiler::Scope stage(Stage::ADVECTION);
+    auto C = m_field_controller->field_concentration;
+    auto C0 = m_field_controller->field_concentration0;
+    auto C_tmp = m_field_controller->field_concentration_tmp;
 
-        // Solve advection equation
 #ifndef BENCHMARKING
-        m_logger->info("Advect Concentration ...");
+    m_logger->info("Advect Concentration ...");
 #endif
-        adv_con->advect(C, C0, u, v, w, sync);
+    adv_con->advect(C, C0, m_field_controller->field_u, m_field_controller->field_v, m_field_controller->field_w, sync);
 
-        // Couple concentration to prepare for diffusion
-        FieldController::couple_scalar(C, C0, C_tmp, sync);
+    // Couple concentration to prepare for diffusion (C0 and C_tmp are coupled again in update_data)
+    FieldController::couple_scalar(C, C0, C_tmp, sync);
+}
 
-        // Solve diffusion equation
-        // turbulence
-        if (m_has_turbulence_concentration) {
-            real Sc_T = params->get_real("solver/concentration/turbulence/Sc_T");
-            real rSc_T = 1. / Sc_T;
+// ***************************************************************************************
+/// \brief  calculates eddy mass diffusivity gamma_t = nu_t/Sc_t
+/// \param  sync        synchronization boolean (true=sync (default), false=async)
+// ***************************************************************************************
+void NSTempTurbConSolver::calc_gamma_t(bool) {
+    if (!m_has_turbulence_concentration) {
+        return;
+    }
+    Profiler::Scope stage(Stage::DIFFUSION);
+    auto d_gamma_t = m_field_controller->field_gamma_t->data;
+    auto d_nu_t = m_field_controller->field_nu_t->data;
+    size_t bsize = Domain::getInstance()->get_size(m_field_controller->field_gamma_t->get_level());
+    real rSc_T = m_rSc_T;
 
 #pragma acc parallel loop independent present(d_gamma_t[:bsize], d_nu_t[:bsize]) async
-            for (size_t i = 0; i < bsize; ++i) d_gamma_t[i] = d_nu_t[i] * rSc_T; // gamma_turb = nu_turb/Sc_turb
+    for (size_t i = 0; i < bsize; ++i) d_gamma_t[i] = d_nu_t[i] * rSc_T; // gamma_turb = nu_turb/Sc_turb
+}
 
+// ***************************************************************************************
+/// \brief  diffuses concentration and adds source
+/// \param  sync        synchronization boolean (true=sync (default), false=async)
+// ***************************************************************************************
+void NSTempTurbConSolver::diffuse_concentration(bool sync) {
+    auto C = m_field_controller->field_concentration;
+    auto C0 = m_field_controller->field_concentration0;
+    auto C_tmp = m_field_controller->field_concentration_tmp;
+    auto gamma = m_gamma;
+
+    // Solve diffusion equation
+    Profiler::Scope stage(Stage::DIFFUSION);
+    // turbulence
+    if (m_has_turbulence_concentration) {
 #ifndef BENCHMARKING
-            m_logger->info("Diffuse turbulent Concentration ...");
+        m_logger->info("Diffuse turbulent Concentration ...");
 #endif
-            dif_con->diffuse(C, C0, C_tmp, gamma, gamma_t, sync);
-
-            // Couple concentration to prepare for adding source
-            FieldController::couple_scalar(C, C0, C_tmp, sync);
-        } else {
-            // no turbulence
-            if (gamma != 0.) {
+        dif_con->diffuse(C, C0, C_tmp, gamma, m_field_controller->field_gamma_t, sync);
+    } else {
+        // no turbulence
+        if (gamma != 0.) {
 #ifndef BENCHMARKING
-                m_logger->info("Diffuse Concentration ...");
+            m_logger->info("Diffuse Concentration ...");
 #endif
-                dif_con->diffuse(C, C0, C_tmp, gamma, sync);
-
-                // Couple concentration to prepare for adding source
-                FieldController::couple_scalar(C, C0, C_tmp, sync);
-            }
+            dif_con->diffuse(C, C0, C_tmp, gamma, sync);
         }
+    }
 
-        // Add source
-        if (m_conFct != SourceMethods::Zero) {
+    // Add source
+    stage.enter(Stage::SOURCE);
+    if (m_conFct != SourceMethods::Zero) {
 
 #ifndef BENCHMARKING
-            m_logger->info("Add concentration source ...");
+        m_logger->info("Add concentration source ...");
 #endif
-            sou_con->add_source(C, S_C, sync);
-
-            // Couple concentration
-            FieldController::couple_scalar(C, C0, C_tmp, sync);
-        }
-
-// 7. Sources updated in Solver::update_sources, TimeIntegration
-
-        if (sync) {
-#pragma acc wait
-        }
-    }//end data
+        sou_con->add_source(C, m_field_controller->field_source_concentration, sync);
+    }
 }
 
 //======================================= Check data ==================================
@@ -15,6 +15,7 @@
 #include "../interfaces/ISource.h"
 #include "../interfaces/ITurbulence.h"
 #include "../utility/GlobalMacrosTypes.h"
+#include "../utility/TaskPool.h"
 #include "../utility/Utility.h"
 #include "../field/FieldController.h"
 
@@ -46,10 +47,21 @@ class NSTempTurbConSolver : public ISolver {
     real m_nu;
     real m_kappa;
     real m_gamma;
+    real m_rPr_T;
+    real m_rSc_T;
     std::string m_dir_vel;
 
     static void control();
 
+    void advect_temperature(bool sync);
+    void calc_kappa_t(bool sync);
+    void diffuse_temperature(bool sync);
+    void advect_concentration(bool sync);
+    void calc_gamma_t(bool sync);
+    void diffuse_concentration(bool sync);
+
+    TaskPool *m_task_pool;
+
     bool m_has_turbulence_temperature;
     bool m_has_turbulence_concentration;
     bool m_has_dissipation;
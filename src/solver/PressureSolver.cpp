@@ -5,6 +5,7 @@
 /// \copyright  <2015-2020> Forschungszentrum Juelich GmbH. All rights reserved.
 
 #include "PressureSolver.h"
+#include "../utility/Profiler.h"
 
 
 PressureSolver::PressureSolver(FieldController *field_controller) {
@@ -45,6 +46,7 @@ void PressureSolver::do_step(real t, bool sync) {
 
 #pragma acc data present(d_p[:bsize], d_rhs[:bsize])
     {
+        Profiler::Scope stage(Stage::PRESSURE);
         pres->pressure(p, rhs, t, sync);
     }  // end data
 }
@@ -6,10 +6,13 @@
 
 #include "SolverSelection.h"
 #include "../advection/SLAdvect.h"
+#include "../advection/MacCormackAdvect.h"
 #include "../diffusion/JacobiDiffuse.h"
 #include "../diffusion/ColoredGaussSeidelDiffuse.h"
 #include "../diffusion/ExplicitDiffuse.h"
+#include "../diffusion/CGDiffuse.h"
 #include "../pressure/VCycleMG.h"
+#include "../pressure/MGPCGPressure.h"
 #include "../source/ExplicitEulerSource.h"
 #include "../turbulence/ConstSmagorinsky.h"
 #include "../turbulence/DynamicSmagorinsky.h"
@@ -27,6 +30,8 @@ static const std::string solver_selection_name = "SolverSelection";
 void SetAdvectionSolver(IAdvection **advectionSolver, const std::string& advectionType) {
     if (advectionType == AdvectionMethods::SemiLagrangian) {
         *advectionSolver = new SLAdvect();
+    } else if (advectionType == AdvectionMethods::MacCormack) {
+        *advectionSolver = new MacCormackAdvect();
     } else {
 #ifndef BENCHMARKING
         auto logger = Utility::create_logger(solver_selection_name);
@@ -50,6 +55,8 @@ void SetDiffusionSolver(IDiffusion **diffusionSolver, const std::string& diffusi
         *diffusionSolver = new ColoredGaussSeidelDiffuse();
     } else if (diffusionType == DiffusionMethods::Explicit) {
         *diffusionSolver = new ExplicitDiffuse();
+    } else if (diffusionType == DiffusionMethods::CG) {
+        *diffusionSolver = new CGDiffuse();
     } else {
 #ifndef BENCHMARKING
         auto logger = Utility::create_logger(solver_selection_name);
@@ -69,6 +76,8 @@ void SetDiffusionSolver(IDiffusion **diffusionSolver, const std::string& diffusi
 void SetPressureSolver(IPressure **pressureSolver, const std::string& pressureType, Field *p, Field *rhs) {
     if (pressureType == PressureMethods::VCycleMG) {
         *pressureSolver = new VCycleMG(p, rhs);
+    } else if (pressureType == PressureMethods::MGPCG) {
+        *pressureSolver = new MGPCGPressure(p, rhs);
     } else {
 #ifndef BENCHMARKING
         auto logger = Utility::create_logger(solver_selection_name);
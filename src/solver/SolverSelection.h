@@ -16,16 +16,19 @@
 
 struct AdvectionMethods {
     inline static const std::string SemiLagrangian = "SemiLagrangian";
+    inline static const std::string MacCormack = "MacCormack";
 };
 
 struct DiffusionMethods {
     inline static const std::string ColoredGaussSeidel = "ColoredGaussSeidel";
     inline static const std::string Jacobi = "Jacobi";
     inline static const std::string Explicit = "Explicit";
+    inline static const std::string CG = "CG";
 };
 
 struct PressureMethods {
     inline static const std::string VCycleMG = "VCycleMG";
+    inline static const std::string MGPCG = "MGPCG";
 };
 
 struct SourceMethods {
@@ -5,6 +5,8 @@
 /// \copyright    <2015-2018> Forschungszentrum Juelich GmbH. All rights reserved.
 
 #include <cmath>
+#include <algorithm>
+#include <vector>
 
 #ifdef _OPENACC
 #include <accelmath.h>
@@ -20,78 +22,101 @@ DynamicSmagorinsky::DynamicSmagorinsky() {
     auto params = Parameters::getInstance();
 
     m_nu = params->get_real("physical_parameters/nu");
+    m_fused = (params->get("solver/turbulence/fused/enabled", "No") == "Yes");
 
-    u_f = new Field(FieldType::U, 0.0);
-    v_f = new Field(FieldType::U, 0.0);
-    w_f = new Field(FieldType::U, 0.0);
-
-    uu = new Field(FieldType::U, 0.0);
-    vv = new Field(FieldType::U, 0.0);
-    ww = new Field(FieldType::U, 0.0);
-    uv = new Field(FieldType::U, 0.0);
-    uw = new Field(FieldType::U, 0.0);
-    vw = new Field(FieldType::U, 0.0);
-
-    uu_f = new Field(FieldType::U, 0.0);
-    vv_f = new Field(FieldType::U, 0.0);
-    ww_f = new Field(FieldType::U, 0.0);
-    uv_f = new Field(FieldType::U, 0.0);
-    uw_f = new Field(FieldType::U, 0.0);
-    vw_f = new Field(FieldType::U, 0.0);
-
-    uf_uf = new Field(FieldType::U, 0.0);
-    vf_vf = new Field(FieldType::U, 0.0);
-    wf_wf = new Field(FieldType::U, 0.0);
-    uf_vf = new Field(FieldType::U, 0.0);
-    uf_wf = new Field(FieldType::U, 0.0);
-    vf_wf = new Field(FieldType::U, 0.0);
-
-    L11 = new Field(FieldType::U, 0.0);
-    L22 = new Field(FieldType::U, 0.0);
-    L33 = new Field(FieldType::U, 0.0);
-    L12 = new Field(FieldType::U, 0.0);
-    L13 = new Field(FieldType::U, 0.0);
-    L23 = new Field(FieldType::U, 0.0);
-
-    S11 = new Field(FieldType::U, 0.0);
-    S22 = new Field(FieldType::U, 0.0);
-    S33 = new Field(FieldType::U, 0.0);
-    S12 = new Field(FieldType::U, 0.0);
-    S13 = new Field(FieldType::U, 0.0);
-    S23 = new Field(FieldType::U, 0.0);
-
-    S11_f = new Field(FieldType::U, 0.0);
-    S22_f = new Field(FieldType::U, 0.0);
-    S33_f = new Field(FieldType::U, 0.0);
-    S12_f = new Field(FieldType::U, 0.0);
-    S13_f = new Field(FieldType::U, 0.0);
-    S23_f = new Field(FieldType::U, 0.0);
-
-    P11 = new Field(FieldType::U, 0.0);
-    P22 = new Field(FieldType::U, 0.0);
-    P33 = new Field(FieldType::U, 0.0);
-    P12 = new Field(FieldType::U, 0.0);
-    P13 = new Field(FieldType::U, 0.0);
-    P23 = new Field(FieldType::U, 0.0);
-
-    P11_f = new Field(FieldType::U, 0.0);
-    P22_f = new Field(FieldType::U, 0.0);
-    P33_f = new Field(FieldType::U, 0.0);
-    P12_f = new Field(FieldType::U, 0.0);
-    P13_f = new Field(FieldType::U, 0.0);
-    P23_f = new Field(FieldType::U, 0.0);
-
-    M11 = new Field(FieldType::U, 0.0);
-    M22 = new Field(FieldType::U, 0.0);
-    M33 = new Field(FieldType::U, 0.0);
-    M12 = new Field(FieldType::U, 0.0);
-    M13 = new Field(FieldType::U, 0.0);
-    M23 = new Field(FieldType::U, 0.0);
-
-    S_bar = new Field(FieldType::U, 0.0);
-    S_bar_f = new Field(FieldType::U, 0.0);
-
-    Cs = new Field(FieldType::U, 0.0);
+    Cs = new FieldLP(FieldType::U, 0.0);
+    auto d_Cs = Cs->data;
+    size_t bsize = Domain::getInstance()->get_size(Cs->get_level());
+#pragma acc enter data copyin(d_Cs[:bsize])
+
+#ifdef _OPENACC
+    m_fused = false;  // row buffers of the fused kernel are per host thread
+#endif
+    if (m_fused) {
+        // the fused kernel only needs to know which neighbours are inner cells
+        m_inner_mask = new char[bsize];
+        std::fill(m_inner_mask, m_inner_mask + bsize, 0);
+    } else {
+        AllocateScratch();
+    }
+}
+
+// =================================== Scratch fields ===================================
+// ***************************************************************************************
+/// \brief  allocates the intermediate fields of the unfused model
+// ***************************************************************************************
+void DynamicSmagorinsky::AllocateScratch() {
+    m_filter = new SeparableFilter();
+
+    u_f = new FieldLP(FieldType::U, 0.0);
+    v_f = new FieldLP(FieldType::U, 0.0);
+    w_f = new FieldLP(FieldType::U, 0.0);
+
+    uu = new FieldLP(FieldType::U, 0.0);
+    vv = new FieldLP(FieldType::U, 0.0);
+    ww = new FieldLP(FieldType::U, 0.0);
+    uv = new FieldLP(FieldType::U, 0.0);
+    uw = new FieldLP(FieldType::U, 0.0);
+    vw = new FieldLP(FieldType::U, 0.0);
+
+    uu_f = new FieldLP(FieldType::U, 0.0);
+    vv_f = new FieldLP(FieldType::U, 0.0);
+    ww_f = new FieldLP(FieldType::U, 0.0);
+    uv_f = new FieldLP(FieldType::U, 0.0);
+    uw_f = new FieldLP(FieldType::U, 0.0);
+    vw_f = new FieldLP(FieldType::U, 0.0);
+
+    uf_uf = new FieldLP(FieldType::U, 0.0);
+    vf_vf = new FieldLP(FieldType::U, 0.0);
+    wf_wf = new FieldLP(FieldType::U, 0.0);
+    uf_vf = new FieldLP(FieldType::U, 0.0);
+    uf_wf = new FieldLP(FieldType::U, 0.0);
+    vf_wf = new FieldLP(FieldType::U, 0.0);
+
+    L11 = new FieldLP(FieldType::U, 0.0);
+    L22 = new FieldLP(FieldType::U, 0.0);
+    L33 = new FieldLP(FieldType::U, 0.0);
+    L12 = new FieldLP(FieldType::U, 0.0);
+    L13 = new FieldLP(FieldType::U, 0.0);
+    L23 = new FieldLP(FieldType::U, 0.0);
+
+    S11 = new FieldLP(FieldType::U, 0.0);
+    S22 = new FieldLP(FieldType::U, 0.0);
+    S33 = new FieldLP(FieldType::U, 0.0);
+    S12 = new FieldLP(FieldType::U, 0.0);
+    S13 = new FieldLP(FieldType::U, 0.0);
+    S23 = new FieldLP(FieldType::U, 0.0);
+
+    S11_f = new FieldLP(FieldType::U, 0.0);
+    S22_f = new FieldLP(FieldType::U, 0.0);
+    S33_f = new FieldLP(FieldType::U, 0.0);
+    S12_f = new FieldLP(FieldType::U, 0.0);
+    S13_f = new FieldLP(FieldType::U, 0.0);
+    S23_f = new FieldLP(FieldType::U, 0.0);
+
+    P11 = new FieldLP(FieldType::U, 0.0);
+    P22 = new FieldLP(FieldType::U, 0.0);
+    P33 = new FieldLP(FieldType::U, 0.0);
+    P12 = new FieldLP(FieldType::U, 0.0);
+    P13 = new FieldLP(FieldType::U, 0.0);
+    P23 = new FieldLP(FieldType::U, 0.0);
+
+    P11_f = new FieldLP(FieldType::U, 0.0);
+    P22_f = new FieldLP(FieldType::U, 0.0);
+    P33_f = new FieldLP(FieldType::U, 0.0);
+    P12_f = new FieldLP(FieldType::U, 0.0);
+    P13_f = new FieldLP(FieldType::U, 0.0);
+    P23_f = new FieldLP(FieldType::U, 0.0);
+
+    M11 = new FieldLP(FieldType::U, 0.0);
+    M22 = new FieldLP(FieldType::U, 0.0);
+    M33 = new FieldLP(FieldType::U, 0.0);
+    M12 = new FieldLP(FieldType::U, 0.0);
+    M13 = new FieldLP(FieldType::U, 0.0);
+    M23 = new FieldLP(FieldType::U, 0.0);
+
+    S_bar = new FieldLP(FieldType::U, 0.0);
+    S_bar_f = new FieldLP(FieldType::U, 0.0);
 
     // Variables related to Dynamic Smagorinsky
     auto d_u_f = u_f->data;
@@ -164,8 +189,6 @@ DynamicSmagorinsky::DynamicSmagorinsky() {
     auto d_M13 = M13->data;
     auto d_M23 = M23->data;
 
-    auto d_Cs = Cs->data;
-
     size_t bsize = Domain::getInstance()->get_size(u_f->get_level());
 
 #pragma acc enter data copyin(d_u_f[:bsize], d_v_f[:bsize], d_w_f[:bsize])
@@ -181,11 +204,26 @@ DynamicSmagorinsky::DynamicSmagorinsky() {
 #pragma acc enter data copyin(d_M11[:bsize], d_M22[:bsize], d_M33[:bsize], d_M12[:bsize], d_M13[:bsize], d_M23[:bsize])
 
 #pragma acc enter data copyin(d_S_bar[:bsize], d_S_bar_f[:bsize])
-
-#pragma acc enter data copyin(d_Cs[:bsize])
 }
 
 DynamicSmagorinsky::~DynamicSmagorinsky() {
+    auto d_Cs = Cs->data;
+    size_t bsize = Domain::getInstance()->get_size(Cs->get_level());
+#pragma acc exit data delete(d_Cs[:bsize])
+    delete Cs;
+
+    if (m_fused) {
+        delete[] m_inner_mask;
+    } else {
+        FreeScratch();
+    }
+    delete m_filter;
+}
+
+// ***************************************************************************************
+/// \brief  frees the intermediate fields of the unfused model
+// ***************************************************************************************
+void DynamicSmagorinsky::FreeScratch() {
 
     auto d_u_f = u_f->data;
     auto d_v_f = v_f->data;
@@ -257,8 +295,6 @@ DynamicSmagorinsky::~DynamicSmagorinsky() {
     auto d_M13 = M13->data;
     auto d_M23 = M23->data;
 
-    auto d_Cs = Cs->data;
-
     size_t bsize = Domain::getInstance()->get_size(u_f->get_level());
 
 #pragma acc exit data delete(d_u_f[:bsize], d_v_f[:bsize], d_w_f[:bsize])
@@ -341,9 +377,6 @@ DynamicSmagorinsky::~DynamicSmagorinsky() {
 #pragma acc exit data delete(d_S_bar[:bsize], d_S_bar_f[:bsize])
     delete S_bar;
     delete S_bar_f;
-
-#pragma acc exit data delete(d_Cs[:bsize])
-    delete Cs;
 }
 
 //============================ Calculate turbulent viscosity =============================
@@ -356,6 +389,10 @@ DynamicSmagorinsky::~DynamicSmagorinsky() {
 /// \param  sync          synchronization boolean (true=sync (default), false=async)
 // ***************************************************************************************
 void DynamicSmagorinsky::CalcTurbViscosity(Field *ev, Field *in_u, Field *in_v, Field *in_w, bool sync) {
+    if (m_fused) {
+        CalcTurbViscosityFused(ev, in_u, in_v, in_w, sync);
+        return;
+    }
 
     auto domain = Domain::getInstance();
 
@@ -469,8 +506,6 @@ void DynamicSmagorinsky::CalcTurbViscosity(Field *ev, Field *in_u, Field *in_v,
 
     const real delta_s = cbrt(dx * dy * dz);
 
-    real num = 0;
-    real den = 0;
     real sum = 0;
 
     auto boundary = BoundaryController::getInstance();
@@ -478,10 +513,9 @@ void DynamicSmagorinsky::CalcTurbViscosity(Field *ev, Field *in_u, Field *in_v,
     auto bsize_i = boundary->getSize_innerList();
 
 // Velocity filter
-    ExplicitFiltering(u_f, in_u, sync);
-    ExplicitFiltering(v_f, in_v, sync);
-    ExplicitFiltering(w_f, in_w, sync);
+    m_filter->filter_vector(u_f, v_f, w_f, in_u, in_v, in_w, sync);
 
+#pragma omp parallel for
 #pragma acc parallel loop independent present(  d_u[:bsize], d_v[:bsize], d_w[:bsize], \
                         d_uu[:bsize], d_vv[:bsize], d_ww[:bsize], \
                         d_uv[:bsize], d_uw[:bsize], d_vw[:bsize], \
@@ -513,13 +547,11 @@ void DynamicSmagorinsky::CalcTurbViscosity(Field *ev, Field *in_u, Field *in_v,
     }
 
 // calculation  of the filter of velocity products
-    ExplicitFiltering(uu_f, uu, sync);
-    ExplicitFiltering(vv_f, vv, sync);
-    ExplicitFiltering(ww_f, ww, sync);
-    ExplicitFiltering(uv_f, uv, sync);
-    ExplicitFiltering(vw_f, vw, sync);
-    ExplicitFiltering(ww_f, ww, sync);
+    m_filter->filter_vector(uu_f, vv_f, ww_f, uu, vv, ww, sync);
+    m_filter->filter(uv_f, uv, sync);
+    m_filter->filter(vw_f, vw, sync);
 
+#pragma omp parallel for
 #pragma acc parallel loop independent present(  d_L11[:bsize], d_L22[:bsize], d_L33[:bsize], d_L12[:bsize], d_L13[:bsize], d_L23[:bsize], \
                         d_S11[:bsize], d_S22[:bsize], d_S33[:bsize], d_S12[:bsize], d_S13[:bsize], d_S23[:bsize], \
                         d_S_bar[:bsize], \
@@ -576,21 +608,14 @@ void DynamicSmagorinsky::CalcTurbViscosity(Field *ev, Field *in_u, Field *in_v,
     }
 
     // filtering the strain tensor
-    ExplicitFiltering(S11_f, S11, sync);
-    ExplicitFiltering(S22_f, S22, sync);
-    ExplicitFiltering(S33_f, S33, sync);
-    ExplicitFiltering(S12_f, S12, sync);
-    ExplicitFiltering(S13_f, S13, sync);
-    ExplicitFiltering(S23_f, S23, sync);
+    m_filter->filter_vector(S11_f, S22_f, S33_f, S11, S22, S33, sync);
+    m_filter->filter_vector(S12_f, S13_f, S23_f, S12, S13, S23, sync);
 
     // filtering the product of strain tensor modulus and strain tensor
-    ExplicitFiltering(P11_f, P11, sync);
-    ExplicitFiltering(P22_f, P22, sync);
-    ExplicitFiltering(P33_f, P33, sync);
-    ExplicitFiltering(P12_f, P12, sync);
-    ExplicitFiltering(P13_f, P13, sync);
-    ExplicitFiltering(P23_f, P23, sync);
+    m_filter->filter_vector(P11_f, P22_f, P33_f, P11, P22, P33, sync);
+    m_filter->filter_vector(P12_f, P13_f, P23_f, P12, P13, P23, sync);
 
+#pragma omp parallel for
 #pragma acc parallel loop independent present(  d_S_bar_f[:bsize], d_S11_f[:bsize], d_S22_f[:bsize], d_S33_f[:bsize], \
                         d_S12_f[:bsize], d_S13_f[:bsize], d_S23_f[:bsize], \
                         d_M11[:bsize], d_M22[:bsize], d_M33[:bsize], \
@@ -618,9 +643,9 @@ void DynamicSmagorinsky::CalcTurbViscosity(Field *ev, Field *in_u, Field *in_v,
         d_M13[i] = 2.0 * delta_s * delta_s * (d_P13_f[i] - alpha * alpha * d_S_bar_f[i] * d_S13_f[i]);
         d_M23[i] = 2.0 * delta_s * delta_s * (d_P23_f[i] - alpha * alpha * d_S_bar_f[i] * d_S23_f[i]);
 
-        num = d_L11[i] * d_M11[i] + d_L22[i] * d_M22[i] * d_L33[i] * d_M33[i]
+        const real num = d_L11[i] * d_M11[i] + d_L22[i] * d_M22[i] * d_L33[i] * d_M33[i]
               + 2.0 * d_L12[i] * d_M12[i] + 2.0 * d_L13[i] * d_M13[i] + 2.0 * d_L23[i] * d_M23[i];
-        den = d_M11[i] * d_M11[i] + d_M22[i] * d_M22[i] * d_M33[i] * d_M33[i]
+        const real den = d_M11[i] * d_M11[i] + d_M22[i] * d_M22[i] * d_M33[i] * d_M33[i]
               + 2.0 * d_M12[i] * d_M12[i] + 2.0 * d_M13[i] * d_M13[i] + 2.0 * d_M23[i] * d_M23[i];
 
         // dynamic constant
@@ -631,7 +656,7 @@ void DynamicSmagorinsky::CalcTurbViscosity(Field *ev, Field *in_u, Field *in_v,
 #pragma acc wait
     }
 
-    // local averaging of the coefficients
+    // local averaging of the coefficients (in place, thus kept sequential)
     for (size_t j = 0; j < bsize_i; ++j) {
         const size_t i = d_iList[j];
         sum = 0;
@@ -647,6 +672,7 @@ void DynamicSmagorinsky::CalcTurbViscosity(Field *ev, Field *in_u, Field *in_v,
     }
 
     // negative coefficients are allowed unless they don't make the effective viscosity zero. In our case d_ev is very small to do that
+#pragma omp parallel for
     for (size_t j = 0; j < bsize_i; ++j) {
         const size_t i = d_iList[j];
         if ((d_ev[i] + m_nu) < 0) {
@@ -655,50 +681,247 @@ void DynamicSmagorinsky::CalcTurbViscosity(Field *ev, Field *in_u, Field *in_v,
     }
 }
 
-//============================ Explicit filtering =============================
+//======================== Calculate turbulent viscosity (fused) ========================
 // ***************************************************************************************
-/// \brief  explicitly filters variables
-/// \param  out           output pointer
-/// \param  in            input pointer
+/// \brief  calculates turbulent viscosity without intermediate fields. Velocity products,
+///         strain tensor and its products are evaluated on the fly and filtered in z
+///         direction row by row. Each thread keeps three of these rows (y direction) in a
+///         ring buffer while it walks through a block of tile_j lines. Same model and
+///         order of operations as CalcTurbViscosity with SeparableFilter. Host kernel.
+/// \param  ev            output pointer
+/// \param  in_u          input pointer of x-velocity
+/// \param  in_v          input pointer of y-velocity
+/// \param  in_w          input pointer of z-velocity
 /// \param  sync          synchronization boolean (true=sync (default), false=async)
 // ***************************************************************************************
-void DynamicSmagorinsky::ExplicitFiltering(Field *out, const Field *in, bool sync) {
+void DynamicSmagorinsky::CalcTurbViscosityFused(Field *ev, Field *in_u, Field *in_v, Field *in_w, bool sync) {
 
     auto domain = Domain::getInstance();
+
     // local variables and parameters for GPU
-    auto d_out = out->data;
-    auto d_in = in->data;
+    auto d_u = in_u->data;
+    auto d_v = in_v->data;
+    auto d_w = in_w->data;
+    auto d_ev = ev->data;
+    auto d_Cs = Cs->data;
+    auto d_mask = m_inner_mask;
 
-    const size_t Nx = domain->get_Nx(out->get_level());
-    const size_t Ny = domain->get_Ny(out->get_level());
-    const size_t bsize = domain->get_size(out->get_level());
-    real sum = 0;
+    const size_t Nx = domain->get_Nx(in_u->get_level());
+    const size_t Ny = domain->get_Ny(in_v->get_level());
+    const size_t Nz = domain->get_Nz(in_w->get_level());
 
-    //Implement a discrete filter by trapezoidal or simpsons rule.
-    real a[3] = {1. / 4., 1. / 2., 1. / 4.};  //trapezoidal weights
-    //real a[3] = {1./6.,1./3.,1./6.};  //simpsons weights
+    const real dx = domain->get_dx(in_u->get_level());
+    const real dy = domain->get_dy(in_v->get_level());
+    const real dz = domain->get_dz(in_w->get_level());
+
+    size_t bsize = domain->get_size(in_u->get_level());
+
+    const real rdx = 1. / dx;
+    const real rdy = 1. / dy;
+    const real rdz = 1. / dz;
+
+    const real alpha = 2.0;
+
+    const real delta_s = cbrt(dx * dy * dz);
+
+    const real a[3] = {1. / 4., 1. / 2., 1. / 4.};  // trapezoidal weights (as SeparableFilter)
 
-    //Construction by product combination for trapezoidal
     auto boundary = BoundaryController::getInstance();
     size_t *d_iList = boundary->get_innerList_level_joined();
     auto bsize_i = boundary->getSize_innerList();
 
-#pragma acc parallel loop independent present(d_out[:bsize], d_in[:bsize], a[:3], d_iList[:bsize_i]) async
+    // intermediate quantities only exist (are non-zero) in inner cells
+#pragma omp parallel for
+    for (size_t i = 0; i < bsize; ++i) {
+        d_mask[i] = 0;
+    }
+#pragma omp parallel for
+    for (size_t j = 0; j < bsize_i; ++j) {
+        d_mask[d_iList[j]] = 1;
+    }
+
+    const size_t n_jb = (Ny - 2 + tile_j - 1) / tile_j;  // blocks of lines in y direction
+    const size_t row = Nx * n_filtered;
+
+#pragma omp parallel
+    {
+        // per thread: filtered (z direction) rows j-1, j, j+1 (ring buffer) and line filtered in z and y
+        std::vector<real> buffer(4 * row);
+        real *sy = buffer.data() + 3 * row;
+
+#pragma omp for collapse(2) schedule(static)
+        for (size_t k = 1; k < Nz - 1; k++) {
+            for (size_t b = 0; b < n_jb; b++) {
+                const size_t jb = 1 + b * tile_j;
+                const size_t j_end = std::min(jb + tile_j, Ny - 1);
+
+                for (size_t jj = jb - 1; jj <= j_end; jj++) {
+                    // quantities to be filtered (velocities, velocity products, strain tensor, strain
+                    // products) of row jj, filtered in z direction
+                    real *sz = buffer.data() + (jj % 3) * row;
+                    for (size_t x = 0; x < Nx; x++) {
+                        real *sz_x = sz + x * n_filtered;
+                        for (size_t n = 0; n < 3; n++) {
+                            const size_t c = IX(x, jj, k + n - 1, Nx, Ny);
+                            real q[n_filtered];
+                            q[0] = d_u[c];
+                            q[1] = d_v[c];
+                            q[2] = d_w[c];
+                            if (d_mask[c] == 0) {
+                                for (size_t s = 3; s < n_filtered; s++) {
+                                    q[s] = 0;
+                                }
+                            } else {
+                                const real S11 = (d_u[c + 1] - d_u[c - 1]) * 0.5 * rdx;
+                                const real S22 = (d_v[c + Nx] - d_v[c - Nx]) * 0.5 * rdy;
+                                const real S33 = (d_w[c + Nx * Ny] - d_w[c - Nx * Ny]) * 0.5 * rdz;
+                                const real S12 = 0.5 * ((d_u[c + Nx] - d_u[c - Nx]) * 0.5 * rdy \
+ + (d_v[c + 1] - d_v[c - 1]) * 0.5 * rdx);
+                                const real S13 = 0.5 * ((d_u[c + Nx * Ny] - d_u[c - Nx * Ny]) * 0.5 * rdz \
+ + (d_w[c + 1] - d_w[c - 1]) * 0.5 * rdx);
+                                const real S23 = 0.5 * ((d_v[c + Nx * Ny] - d_v[c - Nx * Ny]) * 0.5 * rdz \
+ + (d_w[c + Nx] - d_w[c - Nx]) * 0.5 * rdy);
+                                const real S_bar = sqrt(2. * (S11 * S11 + S22 * S22 + S33 * S33 \
+ + 2. * (S12 * S12) + 2. * (S13 * S13) + 2. * (S23 * S23)));
+
+                                q[3] = d_u[c] * d_u[c];
+                                q[4] = d_v[c] * d_v[c];
+                                q[5] = d_w[c] * d_w[c];
+                                q[6] = d_u[c] * d_v[c];
+                                q[7] = d_v[c] * d_w[c];
+                                q[8] = S11;
+                                q[9] = S22;
+                                q[10] = S33;
+                                q[11] = S12;
+                                q[12] = S13;
+                                q[13] = S23;
+                                q[14] = S_bar * S11;
+                                q[15] = S_bar * S22;
+                                q[16] = S_bar * S33;
+                                q[17] = S_bar * S12;
+                                q[18] = S_bar * S13;
+                                q[19] = S_bar * S23;
+                            }
+                            // same order of operations as the sweeps of SeparableFilter
+                            for (size_t s = 0; s < n_filtered; s++) {
+                                sz_x[s] = (n == 0) ? a[0] * q[s] : sz_x[s] + a[n] * q[s];
+                            }
+                        }
+                    }
+                    if (jj < jb + 1) continue;
+
+                    // line j: rows j-1, j, j+1 are complete, filter in y direction
+                    const size_t j = jj - 1;
+                    const real *sz_l = buffer.data() + ((j - 1) % 3) * row;
+                    const real *sz_c = buffer.data() + (j % 3) * row;
+                    const real *sz_r = buffer.data() + (jj % 3) * row;
+                    for (size_t s = 0; s < row; s++) {
+                        sy[s] = a[0] * sz_l[s] + a[1] * sz_c[s] + a[2] * sz_r[s];
+                    }
+
+                    for (size_t i_x = 1; i_x < Nx - 1; i_x++) {
+                        const size_t i = IX(i_x, j, k, Nx, Ny);
+                        if (d_mask[i] == 0) continue;
+
+                        // x direction
+                        const real *sy_l = sy + (i_x - 1) * n_filtered;
+                        const real *sy_c = sy + i_x * n_filtered;
+                        const real *sy_r = sy + (i_x + 1) * n_filtered;
+                        real f[n_filtered];
+                        for (size_t s = 0; s < n_filtered; s++) {
+                            f[s] = a[0] * sy_l[s] + a[1] * sy_c[s] + a[2] * sy_r[s];
+                        }
+                        const real u_f = f[0], v_f = f[1], w_f = f[2];
+                        const real uu_f = f[3], vv_f = f[4], ww_f = f[5], uv_f = f[6], vw_f = f[7];
+                        const real S11_f = f[8], S22_f = f[9], S33_f = f[10], S12_f = f[11], S13_f = f[12], S23_f = f[13];
+                        const real P11_f = f[14], P22_f = f[15], P33_f = f[16], P12_f = f[17], P13_f = f[18], P23_f = f[19];
+
+                        // Leonard stress (the unfused path never filters uw, its filter stays zero)
+                        const real L11 = uu_f - u_f * u_f;
+                        const real L22 = vv_f - v_f * v_f;
+                        const real L33 = ww_f - w_f * w_f;
+                        const real L12 = uv_f - u_f * v_f;
+                        const real L13 = 0. - u_f * w_f;
+                        const real L23 = vw_f - v_f * w_f;
+
+                        // modulus of filtered strain tensor
+                        const real S_bar_f = sqrt(2. * (S11_f * S11_f + S22_f * S22_f + S33_f * S33_f \
+ + 2. * (S12_f * S12_f) + 2. * (S13_f * S13_f) + 2. * (S23_f * S23_f)));
+
+                        // High frequency resolved terms
+                        const real M11 = 2.0 * delta_s * delta_s * (P11_f - alpha * alpha * S_bar_f * S11_f);
+                        const real M22 = 2.0 * delta_s * delta_s * (P22_f - alpha * alpha * S_bar_f * S22_f);
+                        const real M33 = 2.0 * delta_s * delta_s * (P33_f - alpha * alpha * S_bar_f * S33_f);
+                        const real M12 = 2.0 * delta_s * delta_s * (P12_f - alpha * alpha * S_bar_f * S12_f);
+                        const real M13 = 2.0 * delta_s * delta_s * (P13_f - alpha * alpha * S_bar_f * S13_f);
+                        const real M23 = 2.0 * delta_s * delta_s * (P23_f - alpha * alpha * S_bar_f * S23_f);
+
+                        // same expressions as the unfused path
+                        const real num = L11 * M11 + L22 * M22 * L33 * M33
+                              + 2.0 * L12 * M12 + 2.0 * L13 * M13 + 2.0 * L23 * M23;
+                        const real den = M11 * M11 + M22 * M22 * M33 * M33
+                              + 2.0 * M12 * M12 + 2.0 * M13 * M13 + 2.0 * M23 * M23;
+
+                        // dynamic constant
+                        d_Cs[i] = num / den;
+
+                        // modulus of strain tensor (kept in ev until the coefficients are averaged)
+                        const real S11 = (d_u[i + 1] - d_u[i - 1]) * 0.5 * rdx;
+                        const real S22 = (d_v[i + Nx] - d_v[i - Nx]) * 0.5 * rdy;
+                        const real S33 = (d_w[i + Nx * Ny] - d_w[i - Nx * Ny]) * 0.5 * rdz;
+                        const real S12 = 0.5 * ((d_u[i + Nx] - d_u[i - Nx]) * 0.5 * rdy \
+ + (d_v[i + 1] - d_v[i - 1]) * 0.5 * rdx);
+                        const real S13 = 0.5 * ((d_u[i + Nx * Ny] - d_u[i - Nx * Ny]) * 0.5 * rdz \
+ + (d_w[i + 1] - d_w[i - 1]) * 0.5 * rdx);
+                        const real S23 = 0.5 * ((d_v[i + Nx * Ny] - d_v[i - Nx * Ny]) * 0.5 * rdz \
+ + (d_w[i + Nx] - d_w[i - Nx]) * 0.5 * rdy);
+                        d_ev[i] = sqrt(2. * (S11 * S11 + S22 * S22 + S33 * S33 \
+ + 2. * (S12 * S12) + 2. * (S13 * S13) + 2. * (S23 * S23)));
+                    }
+                }
+            }
+        }
+    }
+
+    if (sync) {
+#pragma acc wait
+    }
+
+    // local averaging of the coefficients (in place, thus kept sequential)
     for (size_t j = 0; j < bsize_i; ++j) {
         const size_t i = d_iList[j];
-        sum = 0;
-#pragma acc loop independent collapse(3)
+        real sum = 0;
         for (size_t l = 0; l < 3; l++) {
             for (size_t m = 0; m < 3; m++) {
                 for (size_t n = 0; n < 3; n++) {
-                    sum = sum + a[l] * a[m] * a[n] * d_in[i - 1 + l + Nx * (m - 1) + Nx * Ny * (n - 1)];
+                    sum = sum + d_Cs[i - 1 + l + Nx * (m - 1) + Nx * Ny * (n - 1)];
                 }
             }
         }
-        d_out[i] = sum;
+        d_Cs[i] = sum / 27.0;
+        d_ev[i] = 2.0 * d_Cs[i] * delta_s * delta_s * d_ev[i];
     }
 
-    if (sync) {
-#pragma acc wait
+    // negative coefficients are allowed unless they don't make the effective viscosity zero
+#pragma omp parallel for
+    for (size_t j = 0; j < bsize_i; ++j) {
+        const size_t i = d_iList[j];
+        if ((d_ev[i] + m_nu) < 0) {
+            d_ev[i] = 0;
+        }
+    }
+}
+
+//============================ Explicit filtering =============================
+// ***************************************************************************************
+/// \brief  explicitly filters variables
+/// \param  out           output pointer
+/// \param  in            input pointer
+/// \param  sync          synchronization boolean (true=sync (default), false=async)
+// ***************************************************************************************
+void DynamicSmagorinsky::ExplicitFiltering(Field *out, const Field *in, bool sync) {
+    if (m_filter == nullptr) {
+        m_filter = new SeparableFilter();
     }
+    m_filter->filter(out, in, sync);
 }
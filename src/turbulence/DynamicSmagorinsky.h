@@ -9,6 +9,7 @@
 
 #include "../interfaces/ITurbulence.h"
 #include "../field/Field.h"
+#include "../field/SeparableFilter.h"
 
 class DynamicSmagorinsky : public ITurbulence {
 public:
@@ -19,18 +20,31 @@ public:
     void ExplicitFiltering(Field *out, const Field *in, bool sync) override;
 
 private:
-    Field *u_f, *v_f, *w_f;                 // filtered velocities
-    Field *uu, *vv, *ww, *uv, *uw, *vw;           // velocity products
-    Field *uu_f, *vv_f, *ww_f, *uv_f, *uw_f, *vw_f;     // filters of the velocity products
-    Field *uf_uf, *vf_vf, *wf_wf, *uf_vf, *uf_wf, *vf_wf; // product of the filtered velocities
-    Field *L11, *L22, *L33, *L12, *L13, *L23;         // Leonard stress
-    Field *S11, *S22, *S33, *S12, *S13, *S23;         // strain tensor
-    Field *S11_f, *S22_f, *S33_f, *S12_f, *S13_f, *S23_f;   // second filtered strain tensor
-    Field *P11, *P22, *P33, *P12, *P13, *P23;           // Product of strain modulus and strain tensor
-    Field *P11_f, *P22_f, *P33_f, *P12_f, *P13_f, *P23_f;   // second filter for the above
-    Field *M11, *M22, *M33, *M12, *M13, *M23;       // High frequency resolved terms
-    Field *S_bar, *S_bar_f;                 // modulus of strain tensor
-    Field *Cs;                        // dynamic constant
+    void CalcTurbViscosityFused(Field *ev, Field *in_u, Field *in_v, Field *in_w, bool sync);
+    void AllocateScratch();
+    void FreeScratch();
+
+    SeparableFilter *m_filter = nullptr;
+
+    // fused kernel: block of x-lines per task (y direction) and mask of inner cells
+    static constexpr size_t tile_j = 16;
+    static constexpr size_t n_filtered = 20;  // u, v, w, velocity products, strain tensor, strain products
+    bool m_fused;
+    char *m_inner_mask = nullptr;
+
+    // scratch fields (low precision storage in mixed precision builds)
+    FieldLP *u_f, *v_f, *w_f;                 // filtered velocities
+    FieldLP *uu, *vv, *ww, *uv, *uw, *vw;           // velocity products
+    FieldLP *uu_f, *vv_f, *ww_f, *uv_f, *uw_f, *vw_f;     // filters of the velocity products
+    FieldLP *uf_uf, *vf_vf, *wf_wf, *uf_vf, *uf_wf, *vf_wf; // product of the filtered velocities
+    FieldLP *L11, *L22, *L33, *L12, *L13, *L23;         // Leonard stress
+    FieldLP *S11, *S22, *S33, *S12, *S13, *S23;         // strain tensor
+    FieldLP *S11_f, *S22_f, *S33_f, *S12_f, *S13_f, *S23_f;   // second filtered strain tensor
+    FieldLP *P11, *P22, *P33, *P12, *P13, *P23;           // Product of strain modulus and strain tensor
+    FieldLP *P11_f, *P22_f, *P33_f, *P12_f, *P13_f, *P23_f;   // second filter for the above
+    FieldLP *M11, *M22, *M33, *M12, *M13, *M23;       // High frequency resolved terms
+    FieldLP *S_bar, *S_bar_f;                 // modulus of strain tensor
+    FieldLP *Cs;                        // dynamic constant
     real m_nu;                        // viscosity
 };
 
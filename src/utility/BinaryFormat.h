@@ -0,0 +1,41 @@
+/// \file       BinaryFormat.h
+/// \brief      byte order and alignment helpers shared by the binary file formats
+/// \date       Oct 17, 2026
+/// \author     ARTSS developers
+/// \copyright  <2015-2020> Forschungszentrum Juelich GmbH. All rights reserved.
+
+#ifndef ARTSS_UTILITY_BINARYFORMAT_H_
+#define ARTSS_UTILITY_BINARYFORMAT_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+/// \brief  All binary files of ARTSS (snapshots, binary .dat files, checkpoints) store their
+///         numbers little endian and start their arrays at multiples of an alignment, hence
+///         they can be mapped and used in place on little endian machines. Big endian machines
+///         swap the bytes when writing and reading.
+namespace BinaryFormat {
+    inline bool is_little_endian() {
+        const uint16_t test = 1;
+        return *reinterpret_cast<const uint8_t *>(&test) == 1;
+    }
+
+    /// \brief  swaps the byte order of count values of the given size, if the host is big endian
+    inline void to_little_endian(void *data, size_t count, size_t size) {
+        if (is_little_endian()) {
+            return;
+        }
+        auto *bytes = static_cast<uint8_t *>(data);
+        for (size_t c = 0; c < count; c++) {
+            std::reverse(bytes + c * size, bytes + (c + 1) * size);
+        }
+    }
+
+    /// \brief  rounds offset up to the next multiple of alignment
+    inline uint64_t aligned(uint64_t offset, uint64_t alignment) {
+        return (offset + alignment - 1) / alignment * alignment;
+    }
+}
+
+#endif /* ARTSS_UTILITY_BINARYFORMAT_H_ */
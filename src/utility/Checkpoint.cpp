@@ -0,0 +1,342 @@
+/// \file       Checkpoint.cpp
+/// \brief      Checkpoint/restart of the solver state
+/// \date       Oct 17, 2026
+/// \author     ARTSS developers
+/// \copyright  <2015-2020> Forschungszentrum Juelich GmbH. All rights reserved.
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "BinaryFormat.h"
+#include "Checkpoint.h"
+#include "Parameters.h"
+#include "../Domain.h"
+#include "../boundary/BoundaryController.h"
+
+const char magic[8] = {'A', 'R', 'T', 'S', 'S', 'C', 'H', 'K'};
+const uint32_t version = 2;
+// header and field table are followed by the fields, each starting at a multiple of the alignment
+const uint64_t chunk_alignment = 4096;
+const uint64_t chunk_size = 1 << 24;
+
+// ***************************************************************************************
+/// \brief  Constructor
+/// \param  field_controller    fields to be saved/restored
+// ***************************************************************************************
+Checkpoint::Checkpoint(FieldController *field_controller) : m_field_controller(field_controller) {
+#ifndef BENCHMARKING
+    m_logger = Utility::create_logger(typeid(this).name());
+#endif
+    auto params = Parameters::getInstance();
+    m_enabled = (params->get("checkpoint/enabled", "No") == "Yes");
+    m_interval = static_cast<size_t>(std::stoi(params->get("checkpoint/interval", "100")));
+    if (m_interval == 0) {
+        m_interval = 1;
+    }
+    m_threads = static_cast<size_t>(std::stoi(params->get("checkpoint/threads", "4")));
+    if (m_threads == 0) {
+        m_threads = 1;
+    }
+    m_filename = params->get("checkpoint/file", "checkpoint") + ".chk";
+    collect_fields();
+}
+
+// ***************************************************************************************
+/// \brief  list of the saved fields. The sight field is not saved, it is set up from the
+///         obstacles of the XML file.
+// ***************************************************************************************
+void Checkpoint::collect_fields() {
+    auto fc = m_field_controller;
+    m_fields = {{"u",       fc->field_u},
+                {"v",       fc->field_v},
+                {"w",       fc->field_w},
+                {"u0",      fc->field_u0},
+                {"v0",      fc->field_v0},
+                {"w0",      fc->field_w0},
+                {"u_tmp",   fc->field_u_tmp},
+                {"v_tmp",   fc->field_v_tmp},
+                {"w_tmp",   fc->field_w_tmp},
+                {"nu_t",    fc->field_nu_t},
+                {"kappa_t", fc->field_kappa_t},
+                {"gamma_t", fc->field_gamma_t},
+                {"p",       fc->field_p},
+                {"p0",      fc->field_p0},
+                {"rhs",     fc->field_rhs},
+                {"T",       fc->field_T},
+                {"T0",      fc->field_T0},
+                {"T_tmp",   fc->field_T_tmp},
+                {"T_a",     fc->field_T_ambient},
+                {"C",       fc->field_concentration},
+                {"C0",      fc->field_concentration0},
+                {"C_tmp",   fc->field_concentration_tmp},
+                {"f_x",     fc->field_force_x},
+                {"f_y",     fc->field_force_y},
+                {"f_z",     fc->field_force_z},
+                {"S_T",     fc->field_source_T},
+                {"S_C",     fc->field_source_concentration}};
+}
+
+//======================================== Write ========================================
+// ***************************************************************************************
+/// \brief  writes the checkpoint (after the time step is finished)
+/// \param  iteration_step  number of the finished time step
+/// \param  t_cur           time of the finished time step
+// ***************************************************************************************
+void Checkpoint::write(size_t iteration_step, real t_cur) {
+    Domain *domain = Domain::getInstance();
+    size_t bsize = domain->get_size();
+
+#pragma acc wait
+    for (auto &field : m_fields) {
+        auto d_f = field.second->data;
+#pragma acc update host(d_f[:bsize])
+    }
+
+    Header header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, magic, sizeof(header.magic));
+    header.version = version;
+    header.number_of_fields = static_cast<uint32_t>(m_fields.size());
+    header.value_size = sizeof(real);
+    header.chunk_size = chunk_size;
+    header.Nx = domain->get_Nx();
+    header.Ny = domain->get_Ny();
+    header.Nz = domain->get_Nz();
+    header.x1 = domain->get_x1();
+    header.x2 = domain->get_x2();
+    header.y1 = domain->get_y1();
+    header.y2 = domain->get_y2();
+    header.z1 = domain->get_z1();
+    header.z2 = domain->get_z2();
+    header.t_cur = t_cur;
+    header.dt = Parameters::getInstance()->get_real("physical_parameters/dt");
+    header.iteration_step = iteration_step;
+
+    // header page, field table and aligned fields
+    std::vector<FieldEntry> table(m_fields.size());
+    uint64_t offset = BinaryFormat::aligned(chunk_alignment + table.size() * sizeof(FieldEntry), chunk_alignment);
+    for (size_t f = 0; f < m_fields.size(); f++) {
+        std::memset(&table[f], 0, sizeof(FieldEntry));
+        std::strncpy(table[f].name, m_fields[f].first.c_str(), sizeof(table[f].name) - 1);
+        table[f].offset = offset;
+        table[f].length = bsize * sizeof(real);
+        offset += BinaryFormat::aligned(table[f].length, chunk_alignment);
+    }
+    Header file_header = header;
+    std::vector<FieldEntry> file_table = table;
+    header_to_little_endian(file_header);
+    table_to_little_endian(file_table);
+    std::vector<char> preamble(chunk_alignment + table.size() * sizeof(FieldEntry), 0);
+    std::memcpy(preamble.data(), &file_header, sizeof(file_header));
+    std::memcpy(preamble.data() + chunk_alignment, file_table.data(), file_table.size() * sizeof(FieldEntry));
+
+    std::string tmp_filename = m_filename + ".tmp";
+    int fd = open(tmp_filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    bool success = fd >= 0 && ftruncate(fd, static_cast<off_t>(offset)) == 0
+                   && pwrite(fd, preamble.data(), preamble.size(), 0) == static_cast<ssize_t>(preamble.size());
+    if (success) {
+        // the fields are swapped in place on big endian machines and swapped back afterwards
+        fields_to_little_endian();
+        try {
+            transfer(fd, table, true);
+        } catch (const std::runtime_error &) {
+            success = false;
+        }
+        fields_to_little_endian();
+        success = success && fsync(fd) == 0;
+    }
+    if (fd >= 0) {
+        close(fd);
+    }
+    // keep the previous checkpoint, if writing failed
+    if (!success || std::rename(tmp_filename.c_str(), m_filename.c_str()) != 0) {
+#ifndef BENCHMARKING
+        m_logger->error("could not write checkpoint {}", m_filename);
+#else
+        std::cout << "could not write checkpoint " << m_filename << std::endl;
+#endif
+        return;
+    }
+#ifndef BENCHMARKING
+    m_logger->info("checkpoint {} written at t = {} (step {})", m_filename, t_cur, iteration_step);
+#endif
+}
+
+//======================================== Restart ======================================
+// ***************************************************************************************
+/// \brief  restores fields, computational domain and time from a checkpoint
+/// \param  filename        checkpoint file
+/// \param  iteration_step  out: number of the time step saved in the checkpoint
+/// \param  t_cur           out: time saved in the checkpoint
+// ***************************************************************************************
+void Checkpoint::restart(const std::string &filename, size_t *iteration_step, real *t_cur) {
+    Domain *domain = Domain::getInstance();
+    size_t bsize = domain->get_size();
+
+    int fd = open(filename.c_str(), O_RDONLY);
+    Header header;
+    std::vector<FieldEntry> table;
+    bool valid = fd >= 0 && pread(fd, &header, sizeof(header), 0) == static_cast<ssize_t>(sizeof(header));
+    header_to_little_endian(header);
+    valid = valid && std::memcmp(header.magic, magic, sizeof(magic)) == 0
+            && header.version == version
+            && header.value_size == sizeof(real)
+            && header.Nx == domain->get_Nx() && header.Ny == domain->get_Ny() && header.Nz == domain->get_Nz();
+    if (valid) {
+        table.resize(header.number_of_fields);
+        valid = pread(fd, table.data(), table.size() * sizeof(FieldEntry), chunk_alignment)
+                == static_cast<ssize_t>(table.size() * sizeof(FieldEntry));
+        table_to_little_endian(table);
+    }
+    // assign the entries of the file to the fields, all fields have to be present
+    std::vector<FieldEntry> ordered(m_fields.size());
+    for (size_t f = 0; f < m_fields.size() && valid; f++) {
+        bool found = false;
+        for (auto &entry : table) {
+            if (m_fields[f].first == std::string(entry.name, strnlen(entry.name, sizeof(entry.name)))
+                && entry.length == bsize * sizeof(real)) {
+                ordered[f] = entry;
+                found = true;
+            }
+        }
+        valid = found;
+    }
+    if (!valid) {
+#ifndef BENCHMARKING
+        m_logger->critical("{} is not a checkpoint of this simulation", filename);
+#else
+        std::cout << filename << " is not a checkpoint of this simulation" << std::endl;
+#endif
+        std::exit(1);
+    }
+
+    try {
+        transfer(fd, ordered, false);
+    } catch (const std::runtime_error &) {
+#ifndef BENCHMARKING
+        m_logger->critical("could not read checkpoint {}", filename);
+#else
+        std::cout << "could not read checkpoint " << filename << std::endl;
+#endif
+        std::exit(1);
+    }
+    close(fd);
+    fields_to_little_endian();
+
+    // shift the computational domain (adaption) by whole cells
+    long shift_x1 = std::lround((header.x1 - domain->get_x1()) / domain->get_dx());
+    long shift_x2 = std::lround((header.x2 - domain->get_x2()) / domain->get_dx());
+    long shift_y1 = std::lround((header.y1 - domain->get_y1()) / domain->get_dy());
+    long shift_y2 = std::lround((header.y2 - domain->get_y2()) / domain->get_dy());
+    long shift_z1 = std::lround((header.z1 - domain->get_z1()) / domain->get_dz());
+    long shift_z2 = std::lround((header.z2 - domain->get_z2()) / domain->get_dz());
+    if (domain->resize(shift_x1, shift_x2, shift_y1, shift_y2, shift_z1, shift_z2)) {
+        BoundaryController::getInstance()->updateLists();
+    }
+
+    for (auto &field : m_fields) {
+        auto d_f = field.second->data;
+#pragma acc update device(d_f[:bsize])
+    }
+
+    *iteration_step = header.iteration_step;
+    *t_cur = static_cast<real>(header.t_cur);
+#ifndef BENCHMARKING
+    m_logger->info("restarted from checkpoint {} at t = {} (step {})", filename, *t_cur, *iteration_step);
+    if (std::fabs(header.dt - Parameters::getInstance()->get_real("physical_parameters/dt")) > 0) {
+        m_logger->warn("time step of the checkpoint ({}) differs from the XML file", header.dt);
+    }
+#endif
+}
+
+//======================================== Byte order ===================================
+// ***************************************************************************************
+/// \brief  converts the header of a checkpoint to/from little endian
+// ***************************************************************************************
+void Checkpoint::header_to_little_endian(Header &header) {
+    BinaryFormat::to_little_endian(&header.version, 4, sizeof(uint32_t));
+    BinaryFormat::to_little_endian(&header.chunk_size, 4, sizeof(uint64_t));
+    BinaryFormat::to_little_endian(&header.x1, 8, sizeof(double));
+    BinaryFormat::to_little_endian(&header.iteration_step, 1, sizeof(uint64_t));
+}
+
+// ***************************************************************************************
+/// \brief  converts the field table of a checkpoint to/from little endian
+// ***************************************************************************************
+void Checkpoint::table_to_little_endian(std::vector<FieldEntry> &table) {
+    for (auto &entry : table) {
+        BinaryFormat::to_little_endian(&entry.offset, 2, sizeof(uint64_t));
+    }
+}
+
+// ***************************************************************************************
+/// \brief  converts the (host) data of the saved fields to/from little endian
+// ***************************************************************************************
+void Checkpoint::fields_to_little_endian() {
+    if (BinaryFormat::is_little_endian()) {
+        return;
+    }
+    size_t bsize = Domain::getInstance()->get_size();
+    for (auto &field : m_fields) {
+        BinaryFormat::to_little_endian(field.second->data, bsize, sizeof(real));
+    }
+}
+
+//======================================== Transfer =====================================
+// ***************************************************************************************
+/// \brief  writes or reads the fields chunk by chunk with m_threads threads
+/// \param  fd      file descriptor
+/// \param  table   offsets and lengths of the fields (in the order of m_fields)
+/// \param  write   true: pwrite, false: pread
+// ***************************************************************************************
+void Checkpoint::transfer(int fd, const std::vector<FieldEntry> &table, bool write) {
+    struct Chunk {
+        char *data;
+        uint64_t offset;
+        uint64_t length;
+    };
+    std::vector<Chunk> chunks;
+    for (size_t f = 0; f < m_fields.size(); f++) {
+        auto *data = reinterpret_cast<char *>(m_fields[f].second->data);
+        for (uint64_t pos = 0; pos < table[f].length; pos += chunk_size) {
+            chunks.push_back({data + pos, table[f].offset + pos, std::min(chunk_size, table[f].length - pos)});
+        }
+    }
+
+    std::atomic<size_t> next(0);
+    std::atomic<bool> failed(false);
+    auto work = [&]() {
+        for (size_t c = next++; c < chunks.size() && !failed; c = next++) {
+            uint64_t done = 0;
+            while (done < chunks[c].length) {
+                ssize_t n = write ? pwrite(fd, chunks[c].data + done, chunks[c].length - done, chunks[c].offset + done)
+                                  : pread(fd, chunks[c].data + done, chunks[c].length - done, chunks[c].offset + done);
+                if (n <= 0) {
+                    failed = true;
+                    break;
+                }
+                done += static_cast<uint64_t>(n);
+            }
+        }
+    };
+    std::vector<std::thread> threads;
+    for (size_t t = 1; t < std::min(m_threads, chunks.size()); t++) {
+        threads.emplace_back(work);
+    }
+    work();
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    if (failed) {
+        throw std::runtime_error("checkpoint i/o failed");
+    }
+}
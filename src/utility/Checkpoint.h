@@ -0,0 +1,75 @@
+/// \file       Checkpoint.h
+/// \brief      Checkpoint/restart of the solver state
+/// \date       Oct 17, 2026
+/// \author     ARTSS developers
+/// \copyright  <2015-2020> Forschungszentrum Juelich GmbH. All rights reserved.
+
+#ifndef ARTSS_UTILITY_CHECKPOINT_H_
+#define ARTSS_UTILITY_CHECKPOINT_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "GlobalMacrosTypes.h"
+#include "Utility.h"
+#include "../field/FieldController.h"
+
+/// \brief  writes all fields of the FieldController, the extents of the computational domain
+///         (including adaption shifts), the current time and the time step into a binary
+///         file and restores them. The file consists of a header page, a table of the fields
+///         and the fields, each aligned to chunk_alignment and split into chunks which are
+///         written (pwrite) and read (pread) by several threads. All numbers are little endian
+///         (see BinaryFormat.h). Checkpoints are written to
+///         <file>.tmp and renamed afterwards, hence an interrupted write keeps the previous
+///         checkpoint. Enabled by <checkpoint enabled="Yes" interval="100" file="checkpoint"
+///         threads="4"/> (interval in time steps), restarted by the --restart option.
+class Checkpoint {
+public:
+    explicit Checkpoint(FieldController *field_controller);
+
+    bool is_enabled() const { return m_enabled; }
+    bool is_due(size_t iteration_step) const { return m_enabled && iteration_step % m_interval == 0; }
+
+    void write(size_t iteration_step, real t_cur);
+    void restart(const std::string &filename, size_t *iteration_step, real *t_cur);
+
+private:
+    struct Header {
+        char magic[8];
+        uint32_t version;
+        uint32_t number_of_fields;
+        uint32_t value_size;
+        uint32_t reserved;
+        uint64_t chunk_size;
+        uint64_t Nx, Ny, Nz;     // physical domain incl. ghost cells
+        double x1, x2, y1, y2, z1, z2;   // computational domain
+        double t_cur;
+        double dt;
+        uint64_t iteration_step;
+    };
+    struct FieldEntry {
+        char name[48];
+        uint64_t offset;
+        uint64_t length;
+    };
+
+    static void header_to_little_endian(Header &header);
+    static void table_to_little_endian(std::vector<FieldEntry> &table);
+    void fields_to_little_endian();
+
+    void collect_fields();
+    void transfer(int fd, const std::vector<FieldEntry> &table, bool write);
+
+    FieldController *m_field_controller;
+    bool m_enabled;
+    size_t m_interval;
+    size_t m_threads;
+    std::string m_filename;
+    std::vector<std::pair<std::string, Field *>> m_fields;
+#ifndef BENCHMARKING
+    std::shared_ptr<spdlog::logger> m_logger;
+#endif
+};
+
+#endif /* ARTSS_UTILITY_CHECKPOINT_H_ */
@@ -17,6 +17,11 @@
 /// \def real
 /// \brief Defines the data type the solver calculates with
 ///
+/// \def real_lp
+/// \brief Defines the (low precision) storage type of multigrid correction levels
+///        and turbulence scratch fields, float in mixed precision builds
+///        (\c MIXED_PRECISION), else \c real
+///
 /// \def read_ptr
 /// \brief Defines a constant pointer to a constant real, __restrict__
 ///        for GPU version
@@ -32,6 +37,12 @@
 
 typedef double real;  // data type for solver (float, double, ...)
 
+#ifdef MIXED_PRECISION
+typedef float real_lp;  // storage of multigrid levels and turbulence scratch
+#else
+typedef real real_lp;
+#endif
+
 // looks like PGI uses __restrict
 // https://www.auburn.edu/cosam/departments/physics/department/comp-resources/files/pgi/pgicdkrn.pdf
 // p. 14
@@ -61,6 +61,39 @@ std::string Parameters::get(const std::string &raw_path) {
     }
 }
 
+// *****************************************************************************
+/// \brief  gets raw string (from xml-file) of an optional parameter
+/// \param  raw_path       tree path (as string) of xml-file
+/// \param  default_value  returned if the path does not exist in xml-file
+// *****************************************************************************
+std::string Parameters::get(const std::string &raw_path, const std::string &default_value) {
+    auto path = Utility::split(raw_path, '/');
+
+    auto last_path_element = path.back();
+    path.pop_back();
+
+    auto current = this->doc->RootElement();
+
+    for (auto const& cpath : path) {
+        if (!current) {
+            return default_value;
+        }
+        current = current->FirstChildElement(cpath.c_str());
+    }
+
+    if (!current) {
+        return default_value;
+    }
+    if (current->Attribute(last_path_element.c_str())) {
+        return std::string(current->Attribute(last_path_element.c_str()));
+    }
+    current = current->FirstChildElement(last_path_element.c_str());
+    if (!current || !current->GetText()) {
+        return default_value;
+    }
+    return std::string(current->GetText());
+}
+
 // ***************************************************************************************
 /// \brief  gets real number (from xml-file)
 /// \param  raw_path        tree path (as string) of xml-file
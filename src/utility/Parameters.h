@@ -29,6 +29,7 @@ public:
 
     // Getter
     std::string get(const std::string& raw_path);
+    std::string get(const std::string& raw_path, const std::string& default_value);
     real get_real(const std::string& raw_path);
     double get_double(const std::string& raw_path);
     int get_int(const std::string& raw_path);
@@ -0,0 +1,257 @@
+/// \file       Profiler.cpp
+/// \brief      Per stage timers and hardware counters of the time loop
+/// \date       Oct 17, 2026
+/// \author     ARTSS developers
+/// \copyright  <2015-2020> Forschungszentrum Juelich GmbH. All rights reserved.
+
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "Profiler.h"
+#include "Parameters.h"
+
+Profiler *Profiler::single = nullptr; //Singleton
+
+inline static const std::vector<std::string> StageNames = {"advection", "turbulence", "diffusion", "source", "divergence",
+                                                           "pressure", "projection", "boundary", "visualisation"};
+inline static const std::vector<std::string> CounterNames = {"cycles", "llc_misses"};
+// bytes transferred from memory estimated by last level cache misses times cache line size
+const uint64_t cache_line_size = 64;
+
+Profiler::Profiler() : m_step(0), m_t_cur(0), m_number_of_steps(0), m_total_step_ns(0), m_counters(false) {
+#ifndef BENCHMARKING
+    m_logger = Utility::create_logger(typeid(this).name());
+#endif
+    auto params = Parameters::getInstance();
+    m_enabled = (params->get("profiling/enabled", "No") == "Yes");
+    m_filename = params->get("profiling/file", "profile");
+
+    for (size_t s = 0; s < numberOfStages; s++) {
+        m_step_ns[s] = 0;
+        m_total_ns[s] = 0;
+    }
+    for (size_t c = 0; c < numberOfCounters; c++) {
+        m_counter_fd[c] = -1;
+        m_counter_start[c] = 0;
+        m_total_counters[c] = 0;
+    }
+    if (!m_enabled) {
+        return;
+    }
+
+    if (params->get("profiling/counters", "No") == "Yes") {
+        open_counters();
+    }
+
+    m_csv.open(m_filename + ".csv", std::ofstream::out);
+    m_csv << "step,t_cur";
+    for (auto &name : StageNames) {
+        m_csv << "," << name << "_ms";
+    }
+    m_csv << ",total_ms";
+    if (m_counters) {
+        for (auto &name : CounterNames) {
+            m_csv << "," << name;
+        }
+        m_csv << ",llc_bytes";
+    }
+    m_csv << "\n";
+}
+
+Profiler::~Profiler() {
+    for (size_t c = 0; c < numberOfCounters; c++) {
+        if (m_counter_fd[c] >= 0) {
+#ifdef __linux__
+            close(m_counter_fd[c]);
+#endif
+        }
+    }
+}
+
+Profiler *Profiler::getInstance() {
+    if (single == nullptr) {
+        single = new Profiler();
+    }
+    return single;
+}
+
+const std::string &Profiler::get_stage_name(Stage stage) {
+    return StageNames[stage];
+}
+
+//======================================== Counters =====================================
+// ***************************************************************************************
+/// \brief  opens cycle and last level cache miss counters of the calling thread (user space)
+// ***************************************************************************************
+void Profiler::open_counters() {
+#ifdef __linux__
+    const uint64_t configs[] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_CACHE_MISSES};
+    m_counters = true;
+    for (size_t c = 0; c < numberOfCounters; c++) {
+        struct perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = configs[c];
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        m_counter_fd[c] = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+        if (m_counter_fd[c] < 0) {
+            m_counters = false;
+        }
+    }
+#endif
+    if (!m_counters) {
+#ifndef BENCHMARKING
+        m_logger->warn("perf_event counters not available, profiling times only");
+#else
+        std::cout << "perf_event counters not available, profiling times only" << std::endl;
+#endif
+    }
+}
+
+void Profiler::read_counters(uint64_t *values) {
+    for (size_t c = 0; c < numberOfCounters; c++) {
+        values[c] = 0;
+#ifdef __linux__
+        if (read(m_counter_fd[c], values + c, sizeof(uint64_t)) != sizeof(uint64_t)) {
+            values[c] = 0;
+        }
+#endif
+    }
+}
+
+//======================================== Steps ========================================
+// ***************************************************************************************
+/// \brief  starts the measurement of a time step
+/// \param  step    number of time step
+/// \param  t_cur   current time
+// ***************************************************************************************
+void Profiler::begin_step(size_t step, real t_cur) {
+    if (!m_enabled) {
+        return;
+    }
+    m_step = step;
+    m_t_cur = t_cur;
+    for (size_t s = 0; s < numberOfStages; s++) {
+        m_step_ns[s] = 0;
+    }
+    if (m_counters) {
+        read_counters(m_counter_start);
+    }
+    m_step_start = std::chrono::steady_clock::now();
+}
+
+// ***************************************************************************************
+/// \brief  stops the measurement of a time step and writes it to the CSV file
+// ***************************************************************************************
+void Profiler::end_step() {
+    if (!m_enabled) {
+        return;
+    }
+    int64_t step_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_step_start).count();
+    m_total_step_ns += step_ns;
+    m_number_of_steps++;
+
+    m_csv << m_step << "," << m_t_cur;
+    for (size_t s = 0; s < numberOfStages; s++) {
+        int64_t ns = m_step_ns[s];
+        m_total_ns[s] += ns;
+        m_csv << "," << ns * 1e-6;
+    }
+    m_csv << "," << step_ns * 1e-6;
+    if (m_counters) {
+        uint64_t values[numberOfCounters];
+        read_counters(values);
+        for (size_t c = 0; c < numberOfCounters; c++) {
+            uint64_t diff = values[c] - m_counter_start[c];
+            m_total_counters[c] += diff;
+            m_csv << "," << diff;
+        }
+        m_csv << "," << (values[1] - m_counter_start[1]) * cache_line_size;
+    }
+    m_csv << "\n";
+}
+
+//======================================== Summary ======================================
+// ***************************************************************************************
+/// \brief  writes the summary of all steps as JSON file and prints it
+// ***************************************************************************************
+void Profiler::summarize() {
+    if (!m_enabled) {
+        return;
+    }
+    m_csv.close();
+
+    const real n = m_number_of_steps > 0 ? static_cast<real>(m_number_of_steps) : 1.;
+    const real total_ms = m_total_step_ns * 1e-6;
+
+    std::ofstream json(m_filename + "_summary.json", std::ofstream::out);
+    json << "{\n  \"steps\": " << m_number_of_steps << ",\n  \"total_ms\": " << total_ms << ",\n  \"stages\": {\n";
+    std::stringstream table;
+    table << std::fixed << std::setprecision(3);
+    for (size_t s = 0; s < numberOfStages; s++) {
+        real ms = m_total_ns[s] * 1e-6;
+        real share = total_ms > 0 ? ms / total_ms : 0.;
+        json << "    \"" << StageNames[s] << "\": {\"total_ms\": " << ms << ", \"mean_ms\": " << ms / n
+             << ", \"share\": " << share << "}" << (s + 1 < numberOfStages ? "," : "") << "\n";
+        table << "  " << std::setw(14) << std::left << StageNames[s] << std::right << std::setw(12) << ms << " ms "
+              << std::setw(7) << 100. * share << " %\n";
+    }
+    json << "  }";
+    if (m_counters) {
+        json << ",\n  \"counters\": {";
+        for (size_t c = 0; c < numberOfCounters; c++) {
+            json << "\"" << CounterNames[c] << "\": " << m_total_counters[c] << ", ";
+            table << "  " << std::setw(14) << std::left << CounterNames[c] << std::right << std::setw(16) << m_total_counters[c] << "\n";
+        }
+        json << "\"llc_bytes\": " << m_total_counters[1] * cache_line_size << "}";
+        table << "  " << std::setw(14) << std::left << "llc_bytes" << std::right << std::setw(16) << m_total_counters[1] * cache_line_size << "\n";
+    }
+    json << "\n}\n";
+    json.close();
+
+#ifndef BENCHMARKING
+    m_logger->info("Profile of {} steps ({:.3f} ms per step):\n{}", m_number_of_steps, total_ms / n, table.str());
+#else
+    std::cout << "Profile of " << m_number_of_steps << " steps (" << total_ms / n << " ms per step):\n" << table.str() << std::endl;
+#endif
+}
+
+//======================================== Scope ========================================
+Profiler::Scope::Scope(Stage stage) : m_stage(stage) {
+    m_active = Profiler::getInstance()->is_enabled();
+    if (m_active) {
+        m_start = std::chrono::steady_clock::now();
+    }
+}
+
+// ***************************************************************************************
+/// \brief  stops the current stage and starts measuring the given one
+/// \param  stage   next stage
+// ***************************************************************************************
+void Profiler::Scope::enter(Stage stage) {
+    stop();
+    m_stage = stage;
+    m_active = Profiler::getInstance()->is_enabled();
+    if (m_active) {
+        m_start = std::chrono::steady_clock::now();
+    }
+}
+
+void Profiler::Scope::stop() {
+    if (m_active) {
+        int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start).count();
+        Profiler::getInstance()->add_time(m_stage, ns);
+        m_active = false;
+    }
+}
@@ -0,0 +1,88 @@
+/// \file       Profiler.h
+/// \brief      Per stage timers and hardware counters of the time loop
+/// \date       Oct 17, 2026
+/// \author     ARTSS developers
+/// \copyright  <2015-2020> Forschungszentrum Juelich GmbH. All rights reserved.
+
+#ifndef ARTSS_UTILITY_PROFILER_H_
+#define ARTSS_UTILITY_PROFILER_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+#include "GlobalMacrosTypes.h"
+#include "Utility.h"
+
+enum Stage : size_t {
+    ADVECTION = 0, TURBULENCE = 1, DIFFUSION = 2, SOURCE = 3, DIVERGENCE = 4, PRESSURE = 5, PROJECTION = 6,
+    BOUNDARY = 7, VISUALISATION = 8
+};
+const size_t numberOfStages = 9;
+
+/// \brief  collects the wall time of the solver stages per time step (thread safe, stages may
+///         overlap, e.g. boundary is contained in the stage applying it) and optionally cycles
+///         and last level cache misses of the time loop thread via perf_event. Enabled by
+///         <profiling enabled="Yes" file="profile" counters="Yes"/>, writes one CSV line per
+///         step and a JSON summary. Also available in benchmarking builds.
+class Profiler {
+public:
+    static Profiler *getInstance();
+    ~Profiler();
+
+    bool is_enabled() const { return m_enabled; }
+
+    void begin_step(size_t step, real t_cur);
+    void end_step();
+    void add_time(Stage stage, int64_t ns) { m_step_ns[stage] += ns; }
+    void summarize();
+
+    static const std::string &get_stage_name(Stage stage);
+
+    /// \brief  measures the wall time until destruction, stop() or enter() of the next stage
+    class Scope {
+    public:
+        explicit Scope(Stage stage);
+        ~Scope() { stop(); }
+
+        void enter(Stage stage);
+        void stop();
+    private:
+        Stage m_stage;
+        bool m_active;
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+private:
+    Profiler();
+    static Profiler *single;
+
+    void open_counters();
+    void read_counters(uint64_t *values);
+
+    bool m_enabled;
+    std::string m_filename;
+    std::ofstream m_csv;
+
+    size_t m_step;
+    real m_t_cur;
+    size_t m_number_of_steps;
+    std::chrono::steady_clock::time_point m_step_start;
+    std::atomic<int64_t> m_step_ns[numberOfStages];
+    int64_t m_total_ns[numberOfStages];
+    int64_t m_total_step_ns;
+
+    // cycles and last level cache misses, -1 if not available
+    static const size_t numberOfCounters = 2;
+    int m_counter_fd[numberOfCounters];
+    bool m_counters;
+    uint64_t m_counter_start[numberOfCounters];
+    uint64_t m_total_counters[numberOfCounters];
+#ifndef BENCHMARKING
+    std::shared_ptr<spdlog::logger> m_logger;
+#endif
+};
+
+#endif /* ARTSS_UTILITY_PROFILER_H_ */
@@ -0,0 +1,176 @@
+/// \file       TaskPool.cpp
+/// \brief      Work-stealing thread pool executing a graph of dependent tasks
+/// \date       Oct 17, 2026
+/// \author     ARTSS developers
+/// \copyright  <2015-2020> Forschungszentrum Juelich GmbH. All rights reserved.
+
+#include "TaskPool.h"
+
+// ***************************************************************************************
+/// \brief  Constructor, starts n_threads - 1 workers (the caller of run() is the last thread).
+///         With a single thread no worker is started and run() executes the tasks inline.
+/// \param  n_threads   number of threads executing tasks
+// ***************************************************************************************
+TaskPool::TaskPool(size_t n_threads) : m_queued(0), m_remaining(0), m_shutdown(false) {
+    size_t n_workers = n_threads > 1 ? n_threads - 1 : 0;
+    m_queues.resize(n_workers + 1);
+    m_queue_mutex.reset(new std::mutex[n_workers + 1]);
+    for (size_t q = 0; q < n_workers; q++) {
+        m_workers.emplace_back(&TaskPool::work, this, q);
+    }
+}
+
+TaskPool::~TaskPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shutdown = true;
+    }
+    m_signal.notify_all();
+    for (auto &worker : m_workers) {
+        worker.join();
+    }
+}
+
+//======================================== Add task =====================================
+// ***************************************************************************************
+/// \brief  adds a task to the graph executed by the next run()
+/// \param  task            function to be executed
+/// \param  dependencies    ids of previously added tasks, which have to be finished first
+/// \return id of the task
+// ***************************************************************************************
+size_t TaskPool::add_task(std::function<void()> task, const std::vector<size_t> &dependencies) {
+    size_t id = m_tasks.size();
+    m_tasks.emplace_back(new Task);
+    m_tasks[id]->function = std::move(task);
+    m_tasks[id]->open_dependencies = dependencies.size();
+    for (size_t dep : dependencies) {
+        m_tasks[dep]->successors.push_back(id);
+    }
+    return id;
+}
+
+//======================================== Run ==========================================
+// ***************************************************************************************
+/// \brief  executes all added tasks and clears the graph afterwards. Blocks until all tasks
+///         are finished, the calling thread executes tasks as well.
+// ***************************************************************************************
+void TaskPool::run() {
+    const size_t n_queues = m_queues.size();
+    const size_t caller = n_queues - 1;
+    m_remaining = m_tasks.size();
+
+    // collect the roots before the first push, afterwards the workers release successors
+    std::vector<size_t> roots;
+    for (size_t t = 0; t < m_tasks.size(); t++) {
+        if (m_tasks[t]->open_dependencies == 0) {
+            roots.push_back(t);
+        }
+    }
+    // distribute the roots round robin, starting with the workers
+    for (size_t r = 0; r < roots.size(); r++) {
+        push(r % n_queues, roots[r]);
+    }
+
+    while (m_remaining > 0) {
+        if (!try_execute(caller)) {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_signal.wait(lock, [this] { return m_remaining == 0 || m_queued > 0; });
+        }
+    }
+    m_tasks.clear();
+}
+
+//======================================== Work =========================================
+// ***************************************************************************************
+/// \brief  loop of a worker thread
+/// \param  queue   own queue of the worker
+// ***************************************************************************************
+void TaskPool::work(size_t queue) {
+    while (true) {
+        if (try_execute(queue)) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_signal.wait(lock, [this] { return m_shutdown || m_queued > 0; });
+        if (m_shutdown) {
+            return;
+        }
+    }
+}
+
+//======================================== Try execute ==================================
+// ***************************************************************************************
+/// \brief  executes one task, either from the back of the own queue or stolen from the front
+///         of another queue
+/// \param  queue   own queue of the executing thread
+/// \return false, if no task was found
+// ***************************************************************************************
+bool TaskPool::try_execute(size_t queue) {
+    const size_t n_queues = m_queues.size();
+    size_t task = 0;
+    bool found = false;
+    {
+        std::lock_guard<std::mutex> lock(m_queue_mutex[queue]);
+        if (!m_queues[queue].empty()) {
+            task = m_queues[queue].back();
+            m_queues[queue].pop_back();
+            found = true;
+        }
+    }
+    for (size_t s = 1; s < n_queues && !found; s++) {
+        size_t victim = (queue + s) % n_queues;
+        std::lock_guard<std::mutex> lock(m_queue_mutex[victim]);
+        if (!m_queues[victim].empty()) {
+            task = m_queues[victim].front();
+            m_queues[victim].pop_front();
+            found = true;
+        }
+    }
+    if (!found) {
+        return false;
+    }
+    m_queued--;
+    m_tasks[task]->function();
+    finish(queue, task);
+    return true;
+}
+
+//======================================== Push =========================================
+// ***************************************************************************************
+/// \brief  marks a task as ready
+/// \param  queue   queue the task is pushed to
+/// \param  task    id of the task
+// ***************************************************************************************
+void TaskPool::push(size_t queue, size_t task) {
+    {
+        std::lock_guard<std::mutex> lock(m_queue_mutex[queue]);
+        m_queues[queue].push_back(task);
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queued++;
+    }
+    m_signal.notify_all();
+}
+
+//======================================== Finish =======================================
+// ***************************************************************************************
+/// \brief  releases the successors of a finished task into the queue of the executing thread
+/// \param  queue   own queue of the executing thread
+/// \param  task    id of the finished task
+// ***************************************************************************************
+void TaskPool::finish(size_t queue, size_t task) {
+    for (size_t successor : m_tasks[task]->successors) {
+        if (--m_tasks[successor]->open_dependencies == 0) {
+            push(queue, successor);
+        }
+    }
+    bool done;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        done = (--m_remaining == 0);
+    }
+    if (done) {
+        m_signal.notify_all();
+    }
+}
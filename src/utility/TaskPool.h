@@ -0,0 +1,60 @@
+/// \file       TaskPool.h
+/// \brief      Work-stealing thread pool executing a graph of dependent tasks
+/// \date       Oct 17, 2026
+/// \author     ARTSS developers
+/// \copyright  <2015-2020> Forschungszentrum Juelich GmbH. All rights reserved.
+
+#ifndef ARTSS_UTILITY_TASKPOOL_H_
+#define ARTSS_UTILITY_TASKPOOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// \brief  host side executor for independent solver stages. Tasks are added with the ids of
+///         the tasks they depend on, run() executes the graph and returns when all tasks are
+///         finished. Every worker owns a deque (LIFO for the owner, FIFO for thieves), the
+///         calling thread takes part in the execution. Kernels inside a task keep their own
+///         OpenMP/OpenACC parallelism.
+class TaskPool {
+public:
+    explicit TaskPool(size_t n_threads);
+    ~TaskPool();
+
+    size_t add_task(std::function<void()> task, const std::vector<size_t> &dependencies = {});
+    void run();
+
+    size_t get_number_of_threads() const { return m_workers.size() + 1; }
+
+private:
+    struct Task {
+        std::function<void()> function;
+        std::vector<size_t> successors;
+        std::atomic<size_t> open_dependencies;
+    };
+
+    void work(size_t queue);
+    bool try_execute(size_t queue);
+    void push(size_t queue, size_t task);
+    void finish(size_t queue, size_t task);
+
+    std::vector<std::thread> m_workers;
+    // one queue per worker, the last one belongs to the thread calling run()
+    std::vector<std::deque<size_t>> m_queues;
+    std::unique_ptr<std::mutex[]> m_queue_mutex;
+
+    std::vector<std::unique_ptr<Task>> m_tasks;
+    std::atomic<size_t> m_queued;
+    std::atomic<size_t> m_remaining;
+
+    std::mutex m_mutex;
+    std::condition_variable m_signal;
+    bool m_shutdown;
+};
+
+#endif /* ARTSS_UTILITY_TASKPOOL_H_ */
@@ -0,0 +1,148 @@
+/// \file       AsyncWriter.cpp
+/// \brief      Background thread writing snapshots of the fields
+/// \date       Oct 17, 2026
+/// \author     ARTSS developers
+/// \copyright  <2015-2020> Forschungszentrum Juelich GmbH. All rights reserved.
+
+#include <algorithm>
+
+#include "AsyncWriter.h"
+#include "../Domain.h"
+#include "Visual.h"
+
+// ***************************************************************************************
+/// \brief  Constructor, allocates the staging slots and starts the writer thread
+/// \param  visual                    writes the files of a snapshot
+/// \param  queue_depth               number of snapshots which may be pending (at least 1)
+/// \param  has_analytical_solution   analytical solution is written as well
+// ***************************************************************************************
+AsyncWriter::AsyncWriter(Visual *visual, size_t queue_depth, bool has_analytical_solution) :
+        m_visual(visual), m_has_analytical_solution(has_analytical_solution), m_shutdown(false) {
+#ifndef BENCHMARKING
+    m_logger = Utility::create_logger(typeid(this).name());
+#endif
+    m_size = Domain::getInstance()->get_size();
+    m_slots.resize(std::max(queue_depth, static_cast<size_t>(1)));
+    for (size_t slot = 0; slot < m_slots.size(); slot++) {
+        for (size_t f = 0; f < numberOfNumericalFields; f++) {
+            m_slots[slot].numerical[f] = new real[m_size];
+        }
+        for (size_t f = 0; f < numberOfAnalyticalFields; f++) {
+            m_slots[slot].analytical[f] = m_has_analytical_solution ? new real[m_size] : nullptr;
+        }
+        m_free.push_back(slot);
+    }
+    m_writer = std::thread(&AsyncWriter::work, this);
+}
+
+AsyncWriter::~AsyncWriter() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shutdown = true;
+    }
+    m_snapshot_queued.notify_all();
+    m_writer.join();
+
+    for (auto &snapshot : m_slots) {
+        for (auto field : snapshot.numerical) {
+            delete[] field;
+        }
+        for (auto field : snapshot.analytical) {
+            delete[] field;
+        }
+    }
+}
+
+//======================================== Write ========================================
+// ***************************************************************************************
+/// \brief  copies the fields (host data) into a free slot and queues it for the writer
+///         thread. Blocks, if all slots are pending.
+/// \param  field_controller      numerical fields
+/// \param  solution              analytical solution (already calculated for this time)
+/// \param  filename              file name of the numerical fields without extension
+/// \param  filename_analytical   file name of the analytical solution without extension
+/// \param  t                     current time
+/// \param  save_vtk              write vtk file
+/// \param  save_csv              write csv file
+// ***************************************************************************************
+void AsyncWriter::write(FieldController *field_controller, Solution *solution,
+                        const std::string &filename, const std::string &filename_analytical, real t,
+                        bool save_vtk, bool save_csv) {
+    size_t slot;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_free.empty()) {
+#ifndef BENCHMARKING
+            m_logger->debug("output queue full, waiting for writer");
+#endif
+            m_slot_freed.wait(lock, [this] { return !m_free.empty(); });
+        }
+        slot = m_free.front();
+        m_free.pop_front();
+    }
+
+    Snapshot &snapshot = m_slots[slot];
+    real *numerical[] = {field_controller->field_u->data,
+                         field_controller->field_v->data,
+                         field_controller->field_w->data,
+                         field_controller->field_p->data,
+                         field_controller->field_rhs->data,
+                         field_controller->field_T->data,
+                         field_controller->field_concentration->data,
+                         field_controller->sight->data,
+                         field_controller->field_nu_t->data,
+                         field_controller->field_source_T->data};
+    for (size_t f = 0; f < numberOfNumericalFields; f++) {
+        std::copy(numerical[f], numerical[f] + m_size, snapshot.numerical[f]);
+    }
+    if (m_has_analytical_solution) {
+        real *analytical[] = {solution->GetU_data(),
+                              solution->GetV_data(),
+                              solution->GetW_data(),
+                              solution->GetP_data(),
+                              solution->GetT_data()};
+        for (size_t f = 0; f < numberOfAnalyticalFields; f++) {
+            std::copy(analytical[f], analytical[f] + m_size, snapshot.analytical[f]);
+        }
+    }
+    snapshot.filename = filename;
+    snapshot.filename_analytical = filename_analytical;
+    snapshot.t = t;
+    snapshot.save_vtk = save_vtk;
+    snapshot.save_csv = save_csv;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pending.push_back(slot);
+    }
+    m_snapshot_queued.notify_one();
+}
+
+//======================================== Work =========================================
+// ***************************************************************************************
+/// \brief  loop of the writer thread, writes pending snapshots in order until shutdown
+// ***************************************************************************************
+void AsyncWriter::work() {
+    while (true) {
+        size_t slot;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_snapshot_queued.wait(lock, [this] { return m_shutdown || !m_pending.empty(); });
+            if (m_pending.empty()) {
+                return;
+            }
+            slot = m_pending.front();
+            m_pending.pop_front();
+        }
+
+        Snapshot &snapshot = m_slots[slot];
+        m_visual->write_files(snapshot.numerical, snapshot.analytical, snapshot.filename,
+                              snapshot.filename_analytical, snapshot.t, snapshot.save_vtk, snapshot.save_csv);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_free.push_back(slot);
+        }
+        m_slot_freed.notify_one();
+    }
+}
@@ -0,0 +1,71 @@
+/// \file       AsyncWriter.h
+/// \brief      Background thread writing snapshots of the fields
+/// \date       Oct 17, 2026
+/// \author     ARTSS developers
+/// \copyright  <2015-2020> Forschungszentrum Juelich GmbH. All rights reserved.
+
+#ifndef ARTSS_VISUALISATION_ASYNCWRITER_H_
+#define ARTSS_VISUALISATION_ASYNCWRITER_H_
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../analysis/Solution.h"
+#include "../field/FieldController.h"
+#include "../utility/GlobalMacrosTypes.h"
+#include "../utility/Utility.h"
+
+class Visual;
+
+const size_t numberOfNumericalFields = 10;  // u, v, w, p, div, T, C, s, nu_t, S_T
+const size_t numberOfAnalyticalFields = 5;  // u, v, w, p, T
+
+/// \brief  decouples the VTK/CSV output from the time loop. write() copies the fields into a
+///         free staging slot and returns, a dedicated thread writes the files. The number of
+///         slots bounds the queue: if all slots are pending, write() waits for the writer
+///         (backpressure). The files are written by Visual::write_files. The destructor writes
+///         all pending snapshots.
+class AsyncWriter {
+public:
+    AsyncWriter(Visual *visual, size_t queue_depth, bool has_analytical_solution);
+    ~AsyncWriter();
+
+    void write(FieldController *field_controller, Solution *solution,
+               const std::string &filename, const std::string &filename_analytical, real t,
+               bool save_vtk, bool save_csv);
+
+private:
+    struct Snapshot {
+        real *numerical[numberOfNumericalFields];
+        real *analytical[numberOfAnalyticalFields];
+        std::string filename;
+        std::string filename_analytical;
+        real t;
+        bool save_vtk;
+        bool save_csv;
+    };
+
+    void work();
+
+    Visual *m_visual;
+    size_t m_size;
+    bool m_has_analytical_solution;
+    std::vector<Snapshot> m_slots;
+    std::deque<size_t> m_free;
+    std::deque<size_t> m_pending;
+
+    std::mutex m_mutex;
+    std::condition_variable m_slot_freed;
+    std::condition_variable m_snapshot_queued;
+    bool m_shutdown;
+    std::thread m_writer;
+#ifndef BENCHMARKING
+    std::shared_ptr<spdlog::logger> m_logger;
+#endif
+};
+
+#endif /* ARTSS_VISUALISATION_ASYNCWRITER_H_ */
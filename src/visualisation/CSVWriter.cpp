@@ -36,6 +36,25 @@ void CSVWriter::write_analytical(Solution *solution, const std::string& filename
     CSVWriter::csvPrepareAndWrite((filename + ending).c_str(), u, v, w, p, T);
 }
 
+// ***************************************************************************************
+/// \brief  writes numerical fields given as array (u, v, w, p, div, T, C, s, nu_t, S_T)
+/// \param  fields    pointers to the fields, e.g. a snapshot of the async writer
+/// \param  filename  file name without extension
+// ***************************************************************************************
+void CSVWriter::write_numerical(real **fields, const std::string& filename) {
+    CSVWriter::csvPrepareAndWrite((filename + ending).c_str(), fields[0], fields[1], fields[2], fields[3], fields[4],
+                                   fields[5], fields[6], fields[7], fields[8], fields[9]);
+}
+
+// ***************************************************************************************
+/// \brief  writes analytical fields given as array (u, v, w, p, T)
+/// \param  fields    pointers to the fields, e.g. a snapshot of the async writer
+/// \param  filename  file name without extension
+// ***************************************************************************************
+void CSVWriter::write_analytical(real **fields, const std::string& filename) {
+    CSVWriter::csvPrepareAndWrite((filename + ending).c_str(), fields[0], fields[1], fields[2], fields[3], fields[4]);
+}
+
 void CSVWriter::csvPrepareAndWrite(const char *filename, real *u, real *v, real *w, real *p, real *div, real *T, real *C, real *s, real *nu_t, real *S_T) {
     Domain *domain = Domain::getInstance();
     int size = static_cast<int>(domain->get_size());
@@ -15,6 +15,8 @@ class CSVWriter {
 public:
     static void write_numerical(FieldController *field_controller, const std::string& filename);
     static void write_analytical(Solution *solution, const std::string& filename);
+    static void write_numerical(real **fields, const std::string& filename);
+    static void write_analytical(real **fields, const std::string& filename);
 
     static void write_data(std::string *data_titles, real **data, size_t size_data, const std::string& filename);
 
@@ -0,0 +1,53 @@
+/// \file       SnapshotFormat.h
+/// \brief      layout of the columnar binary snapshot files (.snap)
+/// \date       Oct 17, 2026
+/// \author     ARTSS developers
+/// \copyright  <2015-2020> Forschungszentrum Juelich GmbH. All rights reserved.
+
+#ifndef ARTSS_VISUALISATION_SNAPSHOTFORMAT_H_
+#define ARTSS_VISUALISATION_SNAPSHOTFORMAT_H_
+
+#include <cstdint>
+#include <cstring>
+
+#include "../utility/BinaryFormat.h"
+
+/// \brief  A snapshot consists of the header, number_of_fields names (name_length bytes each,
+///         zero padded) and, starting at data_offset, one contiguous array of Nx*Ny*Nz values
+///         per field (value_size bytes per value, cell index i + j*Nx + k*Nx*Ny). All numbers
+///         are little endian, data_offset is a multiple of alignment, hence the file can be
+///         mapped and the fields used in place.
+namespace SnapshotFormat {
+    const char magic[8] = {'A', 'R', 'T', 'S', 'S', 'N', 'A', 'P'};
+    const uint32_t version = 1;
+    const size_t name_length = 64;
+    const size_t alignment = 64;
+
+    struct Header {
+        char magic[8];
+        uint32_t version;
+        uint32_t number_of_fields;
+        uint32_t value_size;
+        uint32_t reserved;
+        uint64_t Nx, Ny, Nz;
+        double X1, Y1, Z1;
+        double dx, dy, dz;
+        double t;
+        uint64_t data_offset;
+    };
+    static_assert(sizeof(Header) == 112, "unexpected padding of the snapshot header");
+
+    /// \brief  converts the header of a snapshot to/from little endian
+    inline void header_to_little_endian(Header &header) {
+        BinaryFormat::to_little_endian(&header.version, 4, sizeof(uint32_t));
+        BinaryFormat::to_little_endian(&header.Nx, 3, sizeof(uint64_t));
+        BinaryFormat::to_little_endian(&header.X1, 7, sizeof(double));
+        BinaryFormat::to_little_endian(&header.data_offset, 1, sizeof(uint64_t));
+    }
+
+    inline uint64_t data_offset(uint32_t number_of_fields) {
+        return BinaryFormat::aligned(sizeof(Header) + number_of_fields * name_length, alignment);
+    }
+}
+
+#endif /* ARTSS_VISUALISATION_SNAPSHOTFORMAT_H_ */
@@ -0,0 +1,104 @@
+/// \file       SnapshotWriter.cpp
+/// \brief      class to write out columnar binary snapshots
+/// \date       Oct 17, 2026
+/// \author     ARTSS developers
+/// \copyright  <2015-2020> Forschungszentrum Juelich GmbH. All rights reserved.
+
+#include <fstream>
+#include <vector>
+
+#include "SnapshotWriter.h"
+#include "SnapshotFormat.h"
+#include "../Domain.h"
+
+static std::string ending = ".snap";
+
+// column titles of the CSV output
+inline static const char *NumericalVarNames[] = {"x-velocity (m/s)", "y-velocity (m/s)", "z-velocity (m/s)",
+                                                 "pressure (kg/(m s^2))",
+                                                 "divergence (1/s)",
+                                                 "temperature (Celsius)",
+                                                 "concentration (g/m^3)",
+                                                 "sight",
+                                                 "turb viscosity (m^2/s)",
+                                                 "temperature source (K/s)"};
+inline static const char *AnalyticalVarNames[] = {"x-velocity (m/s)", "y-velocity (m/s)", "z-velocity (m/s)",
+                                                  "pressure (kg/(m s^2))",
+                                                  "temperature (Celsius)"};
+
+// ***************************************************************************************
+/// \brief  writes numerical fields given as array (u, v, w, p, div, T, C, s, nu_t, S_T)
+/// \param  fields    pointers to the fields
+/// \param  filename  file name without extension
+/// \param  t         current time
+// ***************************************************************************************
+void SnapshotWriter::write_numerical(real **fields, const std::string &filename, real t) {
+    SnapshotWriter::write(filename + ending, fields, NumericalVarNames, 10, t);
+}
+
+// ***************************************************************************************
+/// \brief  writes analytical fields given as array (u, v, w, p, T)
+/// \param  fields    pointers to the fields
+/// \param  filename  file name without extension
+/// \param  t         current time
+// ***************************************************************************************
+void SnapshotWriter::write_analytical(real **fields, const std::string &filename, real t) {
+    SnapshotWriter::write(filename + ending, fields, AnalyticalVarNames, 5, t);
+}
+
+//================================= Snapshot ============================================
+// ***************************************************************************************
+/// \brief  writes header, field names and the fields (one contiguous array each)
+/// \param  filename          name of the snapshot file
+/// \param  fields            pointers to the fields
+/// \param  var_names         names of the fields
+/// \param  number_of_fields  number of fields
+/// \param  t                 current time
+// ***************************************************************************************
+void SnapshotWriter::write(const std::string &filename, real **fields, const char **var_names,
+                           uint32_t number_of_fields, real t) {
+    Domain *domain = Domain::getInstance();
+    size_t size = domain->get_size();
+
+    SnapshotFormat::Header header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, SnapshotFormat::magic, sizeof(header.magic));
+    header.version = SnapshotFormat::version;
+    header.number_of_fields = number_of_fields;
+    header.value_size = sizeof(real);
+    header.Nx = domain->get_Nx();
+    header.Ny = domain->get_Ny();
+    header.Nz = domain->get_Nz();
+    header.X1 = domain->get_X1();
+    header.Y1 = domain->get_Y1();
+    header.Z1 = domain->get_Z1();
+    header.dx = domain->get_dx();
+    header.dy = domain->get_dy();
+    header.dz = domain->get_dz();
+    header.t = t;
+    header.data_offset = SnapshotFormat::data_offset(number_of_fields);
+    uint64_t data_offset = header.data_offset;
+    SnapshotFormat::header_to_little_endian(header);
+
+    // header, names and padding up to the first field
+    std::vector<char> preamble(data_offset, 0);
+    std::memcpy(preamble.data(), &header, sizeof(header));
+    for (uint32_t f = 0; f < number_of_fields; f++) {
+        std::strncpy(preamble.data() + sizeof(header) + f * SnapshotFormat::name_length, var_names[f],
+                     SnapshotFormat::name_length - 1);
+    }
+
+    std::ofstream file(filename, std::ios::out | std::ios::binary);
+    file.write(preamble.data(), static_cast<std::streamsize>(preamble.size()));
+    std::vector<real> swapped;
+    for (uint32_t f = 0; f < number_of_fields; f++) {
+        const real *data = fields[f];
+        if (!BinaryFormat::is_little_endian()) {
+            swapped.assign(data, data + size);
+            BinaryFormat::to_little_endian(swapped.data(), size, sizeof(real));
+            data = swapped.data();
+        }
+        file.write(reinterpret_cast<const char *>(data), static_cast<std::streamsize>(size * sizeof(real)));
+    }
+    file.close();
+}
@@ -0,0 +1,28 @@
+/// \file       SnapshotWriter.h
+/// \brief      class to write out columnar binary snapshots
+/// \date       Oct 17, 2026
+/// \author     ARTSS developers
+/// \copyright  <2015-2020> Forschungszentrum Juelich GmbH. All rights reserved.
+
+#ifndef ARTSS_VISUALISATION_SNAPSHOTWRITER_H_
+#define ARTSS_VISUALISATION_SNAPSHOTWRITER_H_
+
+#include <cstdint>
+#include <string>
+
+#include "../utility/GlobalMacrosTypes.h"
+
+/// \brief  binary replacement of the CSV output (csv_format="binary"), see SnapshotFormat.h.
+///         The fields are written as they are, tools/artss_snapshot2csv converts a snapshot
+///         into the CSV file CSVWriter would have written.
+class SnapshotWriter {
+public:
+    static void write_numerical(real **fields, const std::string &filename, real t);
+    static void write_analytical(real **fields, const std::string &filename, real t);
+
+private:
+    static void write(const std::string &filename, real **fields, const char **var_names,
+                      uint32_t number_of_fields, real t);
+};
+
+#endif /* ARTSS_VISUALISATION_SNAPSHOTWRITER_H_ */
@@ -33,6 +33,25 @@ void VTKWriter::write_analytical(Solution *solution, const std::string& filename
     VTKWriter::vtkPrepareAndWrite((filename + ending).c_str(), u, v, w, p, T);
 }
 
+// ***************************************************************************************
+/// \brief  writes numerical fields given as array (u, v, w, p, div, T, C, s, nu_t, S_T)
+/// \param  fields    pointers to the fields, e.g. a snapshot of the async writer
+/// \param  filename  file name without extension
+// ***************************************************************************************
+void VTKWriter::write_numerical(real **fields, const std::string& filename) {
+    VTKWriter::vtkPrepareAndWrite((filename + ending).c_str(), fields[0], fields[1], fields[2], fields[3], fields[4],
+                                   fields[5], fields[6], fields[7], fields[8], fields[9]);
+}
+
+// ***************************************************************************************
+/// \brief  writes analytical fields given as array (u, v, w, p, T)
+/// \param  fields    pointers to the fields, e.g. a snapshot of the async writer
+/// \param  filename  file name without extension
+// ***************************************************************************************
+void VTKWriter::write_analytical(real **fields, const std::string& filename) {
+    VTKWriter::vtkPrepareAndWrite((filename + ending).c_str(), fields[0], fields[1], fields[2], fields[3], fields[4]);
+}
+
 //================================= Visualization (VTK) ==================================
 // ***************************************************************************************
 /// \brief  Prepares the (numerical) arrays in a correct format and writes the structured grid and its variables
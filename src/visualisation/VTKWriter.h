@@ -14,6 +14,8 @@ class VTKWriter {
 public:
     static void write_numerical(FieldController *field_controller, const std::string& filename);
     static void write_analytical(Solution *solution, const std::string& filename);
+    static void write_numerical(real **fields, const std::string& filename);
+    static void write_analytical(real **fields, const std::string& filename);
 
 private:
     static void vtkPrepareAndWrite(const char *filename, read_ptr u, read_ptr v, read_ptr w, read_ptr p, read_ptr div, read_ptr T, read_ptr C, read_ptr s, read_ptr nu_t, read_ptr S_T);
@@ -0,0 +1,253 @@
+/// \file       VTRWriter.cpp
+/// \brief      class to write out VTK XML rectilinear grid files (.vtr) with a .pvd index
+/// \date       Oct 17, 2026
+/// \author     ARTSS developers
+/// \copyright  <2015-2020> Forschungszentrum Juelich GmbH. All rights reserved.
+
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+#ifdef USE_ZLIB
+#include <zlib.h>
+#endif
+
+#include "VTRWriter.h"
+#include "../Domain.h"
+#include "../utility/BinaryFormat.h"
+
+static std::string ending = ".vtr";
+// uncompressed size of a compressed block (VTK default)
+const static size_t block_size = 32768;
+
+// order of the numerical fields handed over by Visual (u, v, w, p, div, T, C, s, nu_t, S_T)
+inline static const std::vector<std::string> NumericalFieldNames = {"u", "v", "w", "p", "div", "T", "C", "s", "nu_t", "S_T"};
+inline static const char *NumericalVarNames[] = {"x-velocity", "y-velocity", "z-velocity",
+                                                 "pressure",
+                                                 "divergence",
+                                                 "temperature",
+                                                 "concentration",
+                                                 "sight",
+                                                 "turb_visc",
+                                                 "source_T"};
+// order of the analytical fields (u, v, w, p, T)
+inline static const std::vector<std::string> AnalyticalFieldNames = {"u", "v", "w", "p", "T"};
+inline static const char *AnalyticalVarNames[] = {"x-velocity", "y-velocity", "z-velocity",
+                                                  "pressure",
+                                                  "temperature"};
+
+// ***************************************************************************************
+/// \brief  Constructor
+/// \param  filename      name of the simulation (without extension), prefix of the .pvd files
+/// \param  fields        comma separated list of fields to be written (u, v, w, p, div, T, C,
+///                       s, nu_t, S_T) or "all"
+/// \param  compression   compress the appended data with zlib
+// ***************************************************************************************
+VTRWriter::VTRWriter(const std::string &filename, const std::string &fields, bool compression) :
+        m_compression(compression) {
+#ifndef BENCHMARKING
+    m_logger = Utility::create_logger(typeid(this).name());
+#endif
+#ifndef USE_ZLIB
+    if (m_compression) {
+#ifndef BENCHMARKING
+        m_logger->warn("ARTSS was built without zlib, vtr files are written uncompressed");
+#endif
+        m_compression = false;
+    }
+#endif
+
+    std::vector<std::string> selection;
+    if (fields == "all") {
+        selection = NumericalFieldNames;
+    } else {
+        for (auto &name : Utility::split(fields, ',')) {
+            name.erase(std::remove(name.begin(), name.end(), ' '), name.end());
+            if (!name.empty()) {
+                selection.push_back(name);
+            }
+        }
+    }
+    for (auto &name : selection) {
+        auto numerical = std::find(NumericalFieldNames.begin(), NumericalFieldNames.end(), name);
+        if (numerical == NumericalFieldNames.end()) {
+#ifndef BENCHMARKING
+            m_logger->critical("Field {} is not defined for vtr output", name);
+#endif
+            std::exit(1);
+        }
+        m_numerical_fields.push_back(numerical - NumericalFieldNames.begin());
+        auto analytical = std::find(AnalyticalFieldNames.begin(), AnalyticalFieldNames.end(), name);
+        if (analytical != AnalyticalFieldNames.end()) {
+            m_analytical_fields.push_back(analytical - AnalyticalFieldNames.begin());
+        }
+    }
+
+    m_numerical_collection.filename = filename + "_num.pvd";
+    m_analytical_collection.filename = filename + "_ana.pvd";
+}
+
+void VTRWriter::write_numerical(real **fields, const std::string &filename, real t) {
+    write(filename + ending, fields, m_numerical_fields, NumericalVarNames);
+    update_collection(m_numerical_collection, filename + ending, t);
+}
+
+void VTRWriter::write_analytical(real **fields, const std::string &filename, real t) {
+    write(filename + ending, fields, m_analytical_fields, AnalyticalVarNames);
+    update_collection(m_analytical_collection, filename + ending, t);
+}
+
+//================================= Visualization (VTR) ==================================
+// ***************************************************************************************
+/// \brief  writes the selected fields as cell data and the coordinates of the cell faces
+///         (including ghost cells, as the legacy vtk output)
+/// \param  filename    name of the .vtr file
+/// \param  fields      all fields (numerical or analytical)
+/// \param  selection   indices of the fields to be written
+/// \param  var_names   names of all fields
+// ***************************************************************************************
+void VTRWriter::write(const std::string &filename, real **fields, const std::vector<size_t> &selection,
+                      const char **var_names) {
+    Domain *domain = Domain::getInstance();
+    real X1 = domain->get_X1();
+    real Y1 = domain->get_Y1();
+    real Z1 = domain->get_Z1();
+
+    size_t Nx = domain->get_Nx();
+    size_t Ny = domain->get_Ny();
+    size_t Nz = domain->get_Nz();
+
+    real dx = domain->get_dx();
+    real dy = domain->get_dy();
+    real dz = domain->get_dz();
+
+    size_t size = domain->get_size();
+    m_buffer.resize(std::max(size, std::max(Nx, std::max(Ny, Nz)) + 1));
+    m_appended.clear();
+    std::vector<size_t> offsets;
+
+    // cell data
+    for (size_t f : selection) {
+        const real *field = fields[f];
+        for (size_t index = 0; index < size; index++) {
+            m_buffer[index] = static_cast<float>(field[index]);
+        }
+        offsets.push_back(m_appended.size());
+        append(m_buffer.data(), size, m_appended);
+    }
+    // faces of the grid cells
+    const real origins[] = {X1, Y1, Z1};
+    const real spacings[] = {dx, dy, dz};
+    const size_t points[] = {Nx + 1, Ny + 1, Nz + 1};
+    for (size_t d = 0; d < 3; d++) {
+        for (size_t i = 0; i < points[d]; i++) {
+            m_buffer[i] = static_cast<float>(origins[d] + (static_cast<real>(i) - 1) * spacings[d]);
+        }
+        offsets.push_back(m_appended.size());
+        append(m_buffer.data(), points[d], m_appended);
+    }
+
+    std::ostringstream extent;
+    extent << "0 " << Nx << " 0 " << Ny << " 0 " << Nz;
+
+    std::ofstream file(filename, std::ios::out | std::ios::binary);
+    file << "<?xml version=\"1.0\"?>\n"
+         << "<VTKFile type=\"RectilinearGrid\" version=\"1.0\" byte_order=\""
+         << (BinaryFormat::is_little_endian() ? "LittleEndian" : "BigEndian") << "\" header_type=\"UInt64\""
+         << (m_compression ? " compressor=\"vtkZLibDataCompressor\"" : "") << ">\n"
+         << "  <RectilinearGrid WholeExtent=\"" << extent.str() << "\">\n"
+         << "    <Piece Extent=\"" << extent.str() << "\">\n"
+         << "      <CellData>\n";
+    size_t o = 0;
+    for (size_t f : selection) {
+        file << "        <DataArray type=\"Float32\" Name=\"" << var_names[f]
+             << "\" format=\"appended\" offset=\"" << offsets[o++] << "\"/>\n";
+    }
+    file << "      </CellData>\n"
+         << "      <Coordinates>\n";
+    const char *axes[] = {"x", "y", "z"};
+    for (auto &axis : axes) {
+        file << "        <DataArray type=\"Float32\" Name=\"" << axis
+             << "\" format=\"appended\" offset=\"" << offsets[o++] << "\"/>\n";
+    }
+    file << "      </Coordinates>\n"
+         << "    </Piece>\n"
+         << "  </RectilinearGrid>\n"
+         << "  <AppendedData encoding=\"raw\">\n_";
+    file.write(m_appended.data(), static_cast<std::streamsize>(m_appended.size()));
+    file << "\n  </AppendedData>\n"
+         << "</VTKFile>\n";
+    file.close();
+}
+
+// ***************************************************************************************
+/// \brief  appends an array in the raw encoding, i.e. the number of bytes followed by the
+///         data, or, if compressed, the block header (number of blocks, block size, size of
+///         the last block, compressed sizes) followed by the compressed blocks
+/// \param  data        array
+/// \param  length      number of elements
+/// \param  appended    appended data section
+// ***************************************************************************************
+void VTRWriter::append(const float *data, size_t length, std::vector<char> &appended) {
+    const char *bytes = reinterpret_cast<const char *>(data);
+    const uint64_t number_of_bytes = length * sizeof(float);
+    if (!m_compression) {
+        appended.insert(appended.end(), reinterpret_cast<const char *>(&number_of_bytes),
+                        reinterpret_cast<const char *>(&number_of_bytes) + sizeof(uint64_t));
+        appended.insert(appended.end(), bytes, bytes + number_of_bytes);
+        return;
+    }
+#ifdef USE_ZLIB
+    const uint64_t number_of_blocks = number_of_bytes > 0 ? (number_of_bytes + block_size - 1) / block_size : 0;
+    const uint64_t last_block_size = number_of_bytes - (number_of_blocks > 0 ? (number_of_blocks - 1) * block_size : 0);
+    std::vector<uint64_t> header(3 + number_of_blocks);
+    header[0] = number_of_blocks;
+    header[1] = block_size;
+    header[2] = last_block_size;
+
+    size_t header_position = appended.size();
+    appended.resize(header_position + header.size() * sizeof(uint64_t));
+    m_block.resize(compressBound(block_size));
+    for (uint64_t b = 0; b < number_of_blocks; b++) {
+        uLong source_length = (b + 1 < number_of_blocks) ? block_size : last_block_size;
+        uLongf compressed_length = m_block.size();
+        int status = compress2(reinterpret_cast<Bytef *>(m_block.data()), &compressed_length,
+                               reinterpret_cast<const Bytef *>(bytes + b * block_size), source_length, Z_DEFAULT_COMPRESSION);
+        if (status != Z_OK) {
+#ifndef BENCHMARKING
+            m_logger->critical("zlib compression of vtr data failed (error {})", status);
+#endif
+            std::exit(1);
+        }
+        header[3 + b] = compressed_length;
+        appended.insert(appended.end(), m_block.data(), m_block.data() + compressed_length);
+    }
+    std::memcpy(appended.data() + header_position, header.data(), header.size() * sizeof(uint64_t));
+#endif
+}
+
+//================================= Collection (PVD) ====================================
+// ***************************************************************************************
+/// \brief  adds a file to the time series and rewrites the .pvd file
+/// \param  collection  time series
+/// \param  filename    name of the written .vtr file
+/// \param  t           current time
+// ***************************************************************************************
+void VTRWriter::update_collection(Collection &collection, const std::string &filename, real t) {
+    // the .pvd file is in the same directory as the .vtr files
+    size_t last_slash = filename.find_last_of('/');
+    collection.entries.emplace_back(t, last_slash == std::string::npos ? filename : filename.substr(last_slash + 1));
+
+    std::ofstream file(collection.filename, std::ios::out);
+    file << "<?xml version=\"1.0\"?>\n"
+         << "<VTKFile type=\"Collection\" version=\"0.1\">\n"
+         << "  <Collection>\n";
+    for (auto &entry : collection.entries) {
+        file << "    <DataSet timestep=\"" << std::setprecision(12) << entry.first
+             << "\" group=\"\" part=\"0\" file=\"" << entry.second << "\"/>\n";
+    }
+    file << "  </Collection>\n"
+         << "</VTKFile>\n";
+    file.close();
+}
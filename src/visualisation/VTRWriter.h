@@ -0,0 +1,55 @@
+/// \file       VTRWriter.h
+/// \brief      class to write out VTK XML rectilinear grid files (.vtr) with a .pvd index
+/// \date       Oct 17, 2026
+/// \author     ARTSS developers
+/// \copyright  <2015-2020> Forschungszentrum Juelich GmbH. All rights reserved.
+
+#ifndef ARTSS_VISUALISATION_VTRWRITER_H_
+#define ARTSS_VISUALISATION_VTRWRITER_H_
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "../utility/GlobalMacrosTypes.h"
+#include "../utility/Utility.h"
+
+/// \brief  writes the selected cell fields as appended raw binary (optionally zlib compressed
+///         blocks) in a VTK XML RectilinearGrid file. The conversion to float and the
+///         compression use buffers kept for the next call. Each written file is added to a
+///         ParaView collection (<name>_num.pvd / <name>_ana.pvd), which is rewritten after
+///         every step, so that incomplete runs can be loaded as well.
+class VTRWriter {
+public:
+    VTRWriter(const std::string &filename, const std::string &fields, bool compression);
+
+    void write_numerical(real **fields, const std::string &filename, real t);
+    void write_analytical(real **fields, const std::string &filename, real t);
+
+private:
+    struct Collection {
+        std::string filename;
+        std::vector<std::pair<real, std::string>> entries;
+    };
+
+    void write(const std::string &filename, real **fields, const std::vector<size_t> &selection,
+               const char **var_names);
+    void append(const float *data, size_t length, std::vector<char> &appended);
+    static void update_collection(Collection &collection, const std::string &filename, real t);
+
+    bool m_compression;
+    std::vector<size_t> m_numerical_fields;
+    std::vector<size_t> m_analytical_fields;
+    Collection m_numerical_collection;
+    Collection m_analytical_collection;
+
+    // reusable buffers
+    std::vector<float> m_buffer;
+    std::vector<char> m_appended;
+    std::vector<char> m_block;
+#ifndef BENCHMARKING
+    std::shared_ptr<spdlog::logger> m_logger;
+#endif
+};
+
+#endif /* ARTSS_VISUALISATION_VTRWRITER_H_ */
@@ -13,6 +13,7 @@
 #include "../utility/Parameters.h"
 #include "../Domain.h"
 #include "CSVWriter.h"
+#include "SnapshotWriter.h"
 #include "VTKWriter.h"
 
 Visual::Visual(Solution *solution) {
@@ -26,12 +27,28 @@ Visual::Visual(Solution *solution) {
     m_t_end = params->get_real("physical_parameters/t_end");
     if (m_save_csv) {
         m_csv_plots = params->get_int("visualisation/csv_nth_plot");
+        m_csv_binary = (params->get("visualisation/csv_format", "csv") == "binary");
     }
     if (m_save_vtk) {
         m_vtk_plots = params->get_int("visualisation/vtk_nth_plot");
     }
     m_has_analytical_solution = (params->get("solver/solution/available") == "Yes");
     m_solution = solution;
+
+    if (m_save_vtk && params->get("visualisation/vtk_format", "vtk") == "vtr") {
+        m_vtr_writer = new VTRWriter(m_filename, params->get("visualisation/vtk_fields", "all"),
+                                     params->get("visualisation/compression", "No") == "Yes");
+    }
+    if ((m_save_vtk || m_save_csv) && params->get("visualisation/async", "No") == "Yes") {
+        size_t queue_depth = static_cast<size_t>(std::stoi(params->get("visualisation/queue_depth", "2")));
+        m_async_writer = new AsyncWriter(this, queue_depth, m_has_analytical_solution);
+    }
+}
+
+Visual::~Visual() {
+    // writes the pending snapshots
+    delete m_async_writer;
+    delete m_vtr_writer;
 }
 
 void Visual::visualise(FieldController *field_controller, const real t) {
@@ -41,20 +58,72 @@ void Visual::visualise(FieldController *field_controller, const real t) {
     }
 
     std::string filename = create_filename(m_filename, static_cast<int>(std::round(t / m_dt)), false);
-    if (m_save_vtk) {
-        if (fmod(n, m_vtk_plots) == 0 || t >= m_t_end) {
-            VTKWriter::write_numerical(field_controller, filename);
+    bool write_vtk = m_save_vtk && (fmod(n, m_vtk_plots) == 0 || t >= m_t_end);
+    bool write_csv = m_save_csv && (fmod(n, m_csv_plots) == 0 || t >= m_t_end);
+
+    if (!write_vtk && !write_csv) {
+        return;
+    }
+    std::string filename_analytical = create_filename(m_filename, static_cast<int>(t/m_dt), true);
+    if (m_async_writer != nullptr) {
+        m_async_writer->write(field_controller, m_solution, filename, filename_analytical, t, write_vtk, write_csv);
+        return;
+    }
+
+    real *numerical[] = {field_controller->get_field_u_data(),
+                         field_controller->get_field_v_data(),
+                         field_controller->get_field_w_data(),
+                         field_controller->get_field_p_data(),
+                         field_controller->get_field_rhs_data(),
+                         field_controller->get_field_T_data(),
+                         field_controller->get_field_concentration_data(),
+                         field_controller->get_field_sight_data(),
+                         field_controller->get_field_nu_t_data(),
+                         field_controller->get_field_source_T_data()};
+    real *analytical[] = {m_solution->GetU_data(),
+                          m_solution->GetV_data(),
+                          m_solution->GetW_data(),
+                          m_solution->GetP_data(),
+                          m_solution->GetT_data()};
+    write_files(numerical, analytical, filename, filename_analytical, t, write_vtk, write_csv);
+}
+
+// ***************************************************************************************
+/// \brief  writes the output files in the selected formats
+/// \param  numerical             numerical fields (u, v, w, p, div, T, C, s, nu_t, S_T)
+/// \param  analytical            analytical solution (u, v, w, p, T), only used if available
+/// \param  filename              file name of the numerical fields without extension
+/// \param  filename_analytical   file name of the analytical solution without extension
+/// \param  t                     current time
+/// \param  write_vtk             write vtk/vtr files
+/// \param  write_csv             write csv files (or binary snapshots)
+// ***************************************************************************************
+void Visual::write_files(real **numerical, real **analytical, const std::string &filename,
+                         const std::string &filename_analytical, real t, bool write_vtk, bool write_csv) {
+    if (write_vtk) {
+        if (m_vtr_writer != nullptr) {
+            m_vtr_writer->write_numerical(numerical, filename, t);
             if (m_has_analytical_solution) {
-                VTKWriter::write_analytical(m_solution, create_filename(m_filename, static_cast<int>(t/m_dt), true));
+                m_vtr_writer->write_analytical(analytical, filename_analytical, t);
+            }
+        } else {
+            VTKWriter::write_numerical(numerical, filename);
+            if (m_has_analytical_solution) {
+                VTKWriter::write_analytical(analytical, filename_analytical);
             }
         }
     }
 
-    if (m_save_csv) {
-        if (fmod(n, m_csv_plots) == 0 || t >= m_t_end) {
-            CSVWriter::write_numerical(field_controller, filename);
+    if (write_csv) {
+        if (m_csv_binary) {
+            SnapshotWriter::write_numerical(numerical, filename, t);
+            if (m_has_analytical_solution) {
+                SnapshotWriter::write_analytical(analytical, filename_analytical, t);
+            }
+        } else {
+            CSVWriter::write_numerical(numerical, filename);
             if (m_has_analytical_solution) {
-                CSVWriter::write_analytical(m_solution, create_filename(m_filename, static_cast<int>(t/m_dt), true));
+                CSVWriter::write_analytical(analytical, filename_analytical);
             }
         }
     }
@@ -10,12 +10,17 @@
 #include "../analysis/Solution.h"
 #include "../interfaces/ISolver.h"
 #include "../field/FieldController.h"
+#include "AsyncWriter.h"
+#include "VTRWriter.h"
 
 class Visual {
 public:
     explicit Visual(Solution* solution);
+    ~Visual();
 
     void visualise(FieldController *field_controller, real t);
+    void write_files(real **numerical, real **analytical, const std::string &filename,
+                     const std::string &filename_analytical, real t, bool write_vtk, bool write_csv);
 
     static void initialise_grid(float *x_coords, float *y_coords, float *z_coords, int Nx, int Ny, int Nz, real dx, real dy, real dz);
 
@@ -25,12 +30,14 @@ public:
 
     static void write_data(std::string *data_titles, real **data, size_t size_data, std::string filename);
 
-private:
     static std::string remove_extension(const std::string &filename);
 
+private:
+
     std::string m_filename;
     Solution *m_solution;
     bool m_save_csv = false;
+    bool m_csv_binary = false;
     int m_csv_plots = 0;
     bool m_save_vtk = false;
     int m_vtk_plots = 0;
@@ -41,6 +48,11 @@ private:
 
     bool m_has_analytical_solution = false;
 
+    // writes the files in a background thread, nullptr if output is synchronous
+    AsyncWriter *m_async_writer = nullptr;
+    // VTK XML output (vtk_format="vtr"), nullptr if legacy vtk files are written
+    VTRWriter *m_vtr_writer = nullptr;
+
 };
 
 #endif /* ARTSS_VISUALISATION_VISUAL_H_ */
@@ -0,0 +1,36 @@
+if [ ! -f $1 ]
+then
+    echo "File $1 not found"
+    exit 1
+fi
+
+# output written by the writer thread, a single staging slot (time loop waits for the writer)
+$1 ./Test_AsyncWriter.xml
+
+# synchronous output of the same run
+mkdir -p sync
+sed 's/async="Yes"/async="No"/' ./Test_AsyncWriter.xml > sync/Test_AsyncWriter.xml
+cd sync
+$1 ./Test_AsyncWriter.xml
+cd ..
+
+result=0
+number_of_files=0
+for file in *.vtk *.csv
+do
+    cmp $file sync/$file || result=1
+    number_of_files=$((number_of_files + 1))
+done
+if [ $number_of_files -eq 0 ] || [ $number_of_files -ne $(ls sync/*.vtk sync/*.csv | wc -l) ]
+then
+    echo "number of asynchronously written files does not match number of synchronously written files"
+    result=1
+fi
+
+rm -f *.log
+rm -f *.vtk
+rm -f *.csv
+rm -f *.dat
+rm -rf sync
+
+exit $result
@@ -0,0 +1,43 @@
+if [ ! -f $1 ]
+then
+    echo "File $1 not found"
+    exit 1
+fi
+
+compare=$(dirname $1)/artss_compare
+if [ ! -f $compare ]
+then
+    echo "File $compare not found"
+    exit 1
+fi
+
+# binary output
+$1 ./Test_BinaryDat.xml
+
+# text output of the same run
+mkdir -p text
+sed 's/ dat_format="binary"//' ./Test_BinaryDat.xml > text/Test_BinaryDat.xml
+cd text
+$1 ./Test_BinaryDat.xml
+cd ..
+
+# the text files are rounded to 6 significant digits
+result=0
+number_of_files=0
+for dump in *.bin
+do
+    $compare $dump text/${dump%.bin}.dat 1e-5 || result=1
+    number_of_files=$((number_of_files + 1))
+done
+if [ $number_of_files -eq 0 ] || [ $number_of_files -ne $(ls text/*_inner.dat | wc -l) ]
+then
+    echo "number of binary files does not match number of dat files"
+    result=1
+fi
+
+rm -f *.log
+rm -f *.bin
+rm -f *.dat
+rm -rf text
+
+exit $result
@@ -0,0 +1,45 @@
+# compares the errors against the analytical solution at the end time, which the analysis
+# writes into the log files: the MacCormack error of u and v has to stay below the bound and
+# below the error of the semi-Lagrangian scheme
+# usage: python3 error.py <MacCormack log> <semi-Lagrangian log> <bound>
+import re
+import sys
+
+pattern = re.compile(r"\] (\w+) (?:PASSED|FAILED) Test at time (\S+) with error e = (\S+)")
+
+
+def final_errors(filename):
+    errors = {}
+    try:
+        with open(filename) as log:
+            for line in log:
+                match = pattern.search(line)
+                if match:
+                    # the last comparison is the one at the end time
+                    errors[match.group(1)] = float(match.group(3))
+    except IOError:
+        print("test failed, could not read", filename)
+        sys.exit(1)
+    return errors
+
+
+maccormack = final_errors(sys.argv[1])
+semi_lagrangian = final_errors(sys.argv[2])
+bound = float(sys.argv[3])
+
+result = 0
+for field in ["u", "v"]:
+    if field not in maccormack or field not in semi_lagrangian:
+        print("test failed, no error of", field, "in the log files")
+        sys.exit(1)
+    print(field, "error MacCormack:", maccormack[field], "semi-Lagrangian:", semi_lagrangian[field])
+    if not maccormack[field] < bound:
+        print("test failed, error of", field, "exceeds", bound)
+        result = 1
+    if not maccormack[field] < semi_lagrangian[field]:
+        print("test failed, error of", field, "not below the semi-Lagrangian error")
+        result = 1
+
+if result == 0:
+    print("test passed")
+sys.exit(result)
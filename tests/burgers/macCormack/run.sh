@@ -0,0 +1,29 @@
+if [ ! -f $1 ]
+then
+    echo "File $1 not found"
+    exit 1
+fi
+
+$1 ./Test_Burgers_MacCormack.xml
+
+python3 ./verify.py
+
+# same problem with the semi-Lagrangian scheme
+mkdir -p semiLagrangian
+sed -e 's#<advection type="MacCormack"#<advection type="SemiLagrangian"#' \
+    -e 's#output_test_burgers_maccormack.log#output_test_burgers_semilagrangian.log#' \
+    ./Test_Burgers_MacCormack.xml > semiLagrangian/Test_Burgers_MacCormack.xml
+cd semiLagrangian
+$1 ./Test_Burgers_MacCormack.xml
+cd ..
+
+# error against the analytical solution at t_end
+python3 ./error.py output_test_burgers_maccormack.log semiLagrangian/output_test_burgers_semilagrangian.log 1e-03
+result=$?
+
+rm -f *.log
+rm -f *.vtk
+ls *.dat | grep -v '_ref.dat' | xargs rm -r
+rm -rf semiLagrangian
+
+exit $result
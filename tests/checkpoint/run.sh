@@ -0,0 +1,47 @@
+if [ ! -f $1 ]
+then
+    echo "File $1 not found"
+    exit 1
+fi
+
+# run up to t = 0.2, checkpoint after step 20
+mkdir -p first
+sed 's#<t_end> 0.4 </t_end>#<t_end> 0.2 </t_end>#' ./Test_Checkpoint.xml > first/Test_Checkpoint.xml
+cd first
+$1 ./Test_Checkpoint.xml
+cd ..
+
+# complete run up to t = 0.4, checkpoints after step 20 and 40
+mkdir -p full
+cp ./Test_Checkpoint.xml full/
+cd full
+$1 ./Test_Checkpoint.xml
+cd ..
+
+# continue the first run from step 21, the checkpoint after step 40 and the results have to
+# be identical to the complete run
+mkdir -p restart
+cp ./Test_Checkpoint.xml restart/
+cp first/Test_Checkpoint.chk restart/
+cd restart
+$1 ./Test_Checkpoint.xml --restart Test_Checkpoint.chk
+
+result=0
+number_of_files=0
+for file in Test_Checkpoint.chk *.dat
+do
+    cmp $file ../full/$file || result=1
+    number_of_files=$((number_of_files + 1))
+done
+cd ..
+if [ $number_of_files -lt 2 ]
+then
+    echo "no results of the restarted run"
+    result=1
+fi
+
+rm -rf first
+rm -rf full
+rm -rf restart
+
+exit $result
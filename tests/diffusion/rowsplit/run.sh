@@ -0,0 +1 @@
+sh ../../row_split.sh $1 Test_Diffusion_RowSplit.xml u.bin v.bin w.bin
@@ -1,6 +1,9 @@
 import sys
 import numpy as np
 
+# optional tolerance (e.g. for mixed precision builds)
+tol = float(sys.argv[1]) if len(sys.argv) > 1 else 1e-6
+
 try:
     u = np.loadtxt("u.dat")
 except:
@@ -45,7 +48,7 @@ if (v.shape != l0 or w.shape != l0 or u_ref.shape != l0 or v_ref.shape != l0 or
 
 d = np.sum(np.sqrt((u-u_ref)**2 + (v-v_ref)**2 + (w-w_ref)**2))
 
-if d < 1e-6:
+if d < tol:
     print("velocity test passed")
 #sys.exit(0)
 else:
@@ -72,7 +75,7 @@ if (p_ref.shape != l0):
 
 d = np.sum(np.sqrt((p-p_ref)**2))
 
-if d < 1e-6:
+if d < tol:
     print("pressure test passed")
     sys.exit(0)
 else:
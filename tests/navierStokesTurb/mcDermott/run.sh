@@ -6,7 +6,7 @@ fi
 
 $1 ./Test_NavierStokesTurb_McDermott.xml
 
-python3 ./verify.py
+python3 ./verify.py $2
 
 rm -f *.log
 rm -f *.vtk
@@ -0,0 +1,32 @@
+if [ ! -f $1 ]
+then
+    echo "File $1 not found"
+    exit 1
+fi
+
+compare=$(dirname $1)/artss_compare
+if [ ! -f $compare ]
+then
+    echo "File $compare not found"
+    exit 1
+fi
+
+# first time step stops after n_cycle cycles, second one cycles adaptively until tol_res
+$1 ./Test_PressureAdaptive.xml
+
+# second time step needs more than one, but less than max_cycle cycles and reaches tol_res
+awk -F, 'NR == 2 { found = 1; if ($2 > 1 && $2 < 100 && $3 < 1e-07) ok = 1; print "cycles: " $2 ", ||res||: " $3 }
+         END { exit !(found && ok) }' Test_PressureAdaptive_pressure_cycles.csv
+result=$?
+
+if [ $result -eq 0 ]
+then
+    $compare p.dat ../p_ref.dat 1e-5
+    result=$?
+fi
+
+rm -f *.log
+rm -f *.csv
+rm -f *.dat
+
+exit $result
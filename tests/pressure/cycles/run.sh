@@ -0,0 +1,40 @@
+if [ ! -f $1 ]
+then
+    echo "File $1 not found"
+    exit 1
+fi
+
+compare=$(dirname $1)/artss_compare
+if [ ! -f $compare ]
+then
+    echo "File $compare not found"
+    exit 1
+fi
+
+result=0
+
+# W-cycle
+$1 ./Test_PressureCycles.xml
+$compare p.dat ../p_ref.dat 1e-5 || result=1
+
+# F-cycle
+mkdir -p f_cycle
+sed 's#<cycle_type> W </cycle_type>#<cycle_type> F </cycle_type>#' ./Test_PressureCycles.xml > f_cycle/Test_PressureCycles.xml
+cd f_cycle
+$1 ./Test_PressureCycles.xml
+$compare p.dat ../../p_ref.dat 1e-5 || result=1
+cd ..
+
+# V-cycle with full multigrid as initial guess
+mkdir -p fmg
+sed 's#<cycle_type> W </cycle_type>#<cycle_type> V </cycle_type>#; s#<full_multigrid enabled="No"/>#<full_multigrid enabled="Yes"/>#' ./Test_PressureCycles.xml > fmg/Test_PressureCycles.xml
+cd fmg
+$1 ./Test_PressureCycles.xml
+$compare p.dat ../../p_ref.dat 1e-5 || result=1
+cd ..
+
+rm -f *.log
+rm -f *.dat
+rm -rf f_cycle fmg
+
+exit $result
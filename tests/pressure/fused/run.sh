@@ -0,0 +1,31 @@
+if [ ! -f $1 ]
+then
+    echo "File $1 not found"
+    exit 1
+fi
+
+compare=$(dirname $1)/artss_compare
+if [ ! -f $compare ]
+then
+    echo "File $compare not found"
+    exit 1
+fi
+
+# residuum computed while restricting
+$1 ./Test_PressureFused.xml
+
+# residuum stored in residuum0 and restricted afterwards as reference
+mkdir -p unfused
+sed 's#<fused_restriction enabled="Yes"/>#<fused_restriction enabled="No"/>#' ./Test_PressureFused.xml > unfused/Test_PressureFused.xml
+cd unfused
+$1 ./Test_PressureFused.xml
+cd ..
+
+$compare p.bin unfused/p.bin 1e-10
+result=$?
+
+rm -f *.log
+rm -f *.bin
+rm -rf unfused
+
+exit $result
@@ -0,0 +1,31 @@
+if [ ! -f $1 ]
+then
+    echo "File $1 not found"
+    exit 1
+fi
+
+compare=$(dirname $1)/artss_compare
+if [ ! -f $compare ]
+then
+    echo "File $compare not found"
+    exit 1
+fi
+
+# MGPCG with inhomogeneous boundary conditions
+$1 ./Test_PressureMGPCG_Obstacle.xml
+
+# VCycleMG solution of the same problem as reference
+mkdir -p vcycle
+sed 's/type="MGPCG"/type="VCycleMG"/' ./Test_PressureMGPCG_Obstacle.xml > vcycle/Test_PressureMGPCG_Obstacle.xml
+cd vcycle
+$1 ./Test_PressureMGPCG_Obstacle.xml
+cd ..
+
+$compare p.bin vcycle/p.bin 1e-7
+result=$?
+
+rm -f *.log
+rm -f *.bin
+rm -rf vcycle
+
+exit $result
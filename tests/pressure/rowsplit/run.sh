@@ -0,0 +1 @@
+sh ../../row_split.sh $1 Test_PressureRowSplit.xml p.bin
@@ -0,0 +1,17 @@
+if [ ! -f $1 ]
+then
+    echo "File $1 not found"
+    exit 1
+fi
+
+$1 ./Test_Profiler.xml
+
+python3 ./verify.py ./Test_Profiler.xml
+result=$?
+
+rm -f *.log
+rm -f *.dat
+rm -f profile.csv
+rm -f profile_summary.json
+
+exit $result
@@ -0,0 +1,53 @@
+# checks the output of the profiler: profile.csv has to contain one row per time step with the
+# step, the time, the wall time of each stage and the total wall time, profile_summary.json has
+# to parse and contain the number of steps and all stages
+import csv
+import json
+import sys
+import xml.etree.ElementTree as ElementTree
+
+stages = ["advection", "turbulence", "diffusion", "source", "divergence", "pressure", "projection",
+          "boundary", "visualisation"]
+
+parameters = ElementTree.parse(sys.argv[1]).getroot().find("physical_parameters")
+t_end = float(parameters.find("t_end").text)
+dt = float(parameters.find("dt").text)
+steps = int(round(t_end / dt))
+
+try:
+    with open("profile.csv") as f:
+        rows = list(csv.reader(f))
+except IOError:
+    print("test failed, could not read profile.csv")
+    sys.exit(1)
+
+columns = ["step", "t_cur"] + [stage + "_ms" for stage in stages] + ["total_ms"]
+if rows[0] != columns:
+    print("test failed, unexpected columns", rows[0])
+    sys.exit(1)
+if len(rows) - 1 != steps:
+    print("test failed,", len(rows) - 1, "rows instead of", steps)
+    sys.exit(1)
+for number, row in enumerate(rows[1:], start=1):
+    values = [float(value) for value in row]
+    if len(values) != len(columns) or int(values[0]) != number or abs(values[1] - number * dt) > 1e-6 \
+            or min(values[2:]) < 0:
+        print("test failed, invalid row", row)
+        sys.exit(1)
+
+try:
+    with open("profile_summary.json") as f:
+        summary = json.load(f)
+except (IOError, ValueError) as error:
+    print("test failed, could not parse profile_summary.json:", error)
+    sys.exit(1)
+
+if summary.get("steps") != steps:
+    print("test failed, summary reports", summary.get("steps"), "steps instead of", steps)
+    sys.exit(1)
+if sorted(summary.get("stages", {}).keys()) != sorted(stages):
+    print("test failed, unexpected stages in the summary", summary.get("stages"))
+    sys.exit(1)
+
+print("test passed")
+sys.exit(0)
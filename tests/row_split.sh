@@ -0,0 +1,41 @@
+# runs <xml> with row-split sweeps and the same problem with eight strided sub-color sweeps as
+# reference and compares the given binary dumps
+# usage: sh row_split.sh <artss executable> <xml> <file>...
+if [ ! -f $1 ]
+then
+    echo "File $1 not found"
+    exit 1
+fi
+
+compare=$(dirname $1)/artss_compare
+if [ ! -f $compare ]
+then
+    echo "File $compare not found"
+    exit 1
+fi
+
+artss=$1
+xml=$2
+shift 2
+
+# red-black sweeps over rows
+$artss ./$xml
+
+# eight strided sub-color sweeps of the same problem as reference
+mkdir -p colored
+sed 's#<row_split enabled="Yes"/>#<row_split enabled="No"/>#' ./$xml > colored/$xml
+cd colored
+$artss ./$xml
+cd ..
+
+result=0
+for f in "$@"
+do
+    $compare $f colored/$f 1e-12 || result=1
+done
+
+rm -f *.log
+rm -f *.bin
+rm -rf colored
+
+exit $result
@@ -0,0 +1,43 @@
+if [ ! -f $1 ]
+then
+    echo "File $1 not found"
+    exit 1
+fi
+
+converter=$(dirname $1)/artss_snapshot2csv
+if [ ! -f $converter ]
+then
+    echo "File $converter not found"
+    exit 1
+fi
+
+# text output
+$1 ./Test_Snapshot.xml
+
+# binary output of the same run, converted to csv
+mkdir -p binary
+sed 's/save_csv="Yes"/save_csv="Yes" csv_format="binary"/' ./Test_Snapshot.xml > binary/Test_Snapshot.xml
+cd binary
+$1 ./Test_Snapshot.xml
+
+result=0
+number_of_snapshots=0
+for snapshot in *.snap
+do
+    $converter $snapshot || result=1
+    cmp ${snapshot%.snap}.csv ../${snapshot%.snap}.csv || result=1
+    number_of_snapshots=$((number_of_snapshots + 1))
+done
+cd ..
+if [ $number_of_snapshots -eq 0 ] || [ $number_of_snapshots -ne $(ls *.csv | wc -l) ]
+then
+    echo "number of snapshots does not match number of csv files"
+    result=1
+fi
+
+rm -f *.log
+rm -f *.csv
+rm -f *.dat
+rm -rf binary
+
+exit $result
@@ -0,0 +1,34 @@
+if [ ! -f $1 ]
+then
+    echo "File $1 not found"
+    exit 1
+fi
+
+# uncompressed appended data
+$1 ./Test_VTR.xml
+python3 ./verify.py
+result=$?
+
+# zlib compressed blocks of the same run
+mkdir -p compressed
+sed 's/compression="No"/compression="Yes"/' ./Test_VTR.xml > compressed/Test_VTR.xml
+cp ./verify.py compressed/
+cd compressed
+$1 ./Test_VTR.xml
+python3 ./verify.py || result=1
+# without zlib the files are written uncompressed (with a warning)
+if ! grep -q "built without zlib" *.log && grep -L 'compressor="vtkZLibDataCompressor"' *.vtr | grep -q .
+then
+    echo "vtr files are not compressed"
+    result=1
+fi
+cd ..
+
+rm -f *.log
+rm -f *.csv
+rm -f *.vtr
+rm -f *.pvd
+rm -f *.dat
+rm -rf compressed
+
+exit $result
@@ -0,0 +1,115 @@
+# decodes the appended arrays of all .vtr files in the current directory and compares them
+# with the csv files of the same step, checks that the .pvd collection lists every .vtr file
+import glob
+import re
+import struct
+import sys
+import zlib
+
+# order of the numerical fields in the .vtr files and of the field columns in the csv files
+VAR_NAMES = ["x-velocity", "y-velocity", "z-velocity", "pressure", "divergence",
+             "temperature", "concentration", "sight", "turb_visc", "source_T"]
+# i, j, k, index, x, y, z
+NUMBER_OF_COORD_COLUMNS = 7
+
+
+def decode(appended, offset, compressed):
+    if not compressed:
+        (number_of_bytes,) = struct.unpack_from("<Q", appended, offset)
+        data = appended[offset + 8:offset + 8 + number_of_bytes]
+    else:
+        number_of_blocks, block_size, last_block_size = struct.unpack_from("<3Q", appended, offset)
+        sizes = struct.unpack_from("<%dQ" % number_of_blocks, appended, offset + 24)
+        position = offset + 24 + 8 * number_of_blocks
+        data = b""
+        for b, size in enumerate(sizes):
+            block = zlib.decompress(appended[position:position + size])
+            expected = last_block_size if b == number_of_blocks - 1 else block_size
+            if len(block) != expected:
+                raise ValueError("block %d has %d bytes instead of %d" % (b, len(block), expected))
+            data += block
+            position += size
+    return struct.unpack("<%df" % (len(data) // 4), data)
+
+
+def read_vtr(filename):
+    with open(filename, "rb") as f:
+        content = f.read()
+    marker = b'<AppendedData encoding="raw">\n_'
+    position = content.index(marker)
+    header = content[:position].decode()
+    if 'header_type="UInt64"' not in header or 'byte_order="LittleEndian"' not in header:
+        raise ValueError("unexpected header")
+    compressed = 'compressor="vtkZLibDataCompressor"' in header
+    appended = content[position + len(marker):]
+    arrays = {}
+    for name, offset in re.findall(r'Name="([^"]*)" format="appended" offset="(\d+)"', header):
+        arrays[name] = decode(appended, int(offset), compressed)
+    extent = [int(e) for e in re.search(r'WholeExtent="([^"]*)"', header).group(1).split()]
+    return arrays, extent
+
+
+def read_csv(filename):
+    with open(filename) as f:
+        lines = f.read().splitlines()[1:]
+    return [[float(value) for value in line.split(",")] for line in lines]
+
+
+def to_float(value):
+    return struct.unpack("<f", struct.pack("<f", value))[0]
+
+
+def compare(vtr_file):
+    arrays, extent = read_vtr(vtr_file)
+    nx, ny, nz = extent[1], extent[3], extent[5]
+    size = nx * ny * nz
+    rows = read_csv(vtr_file[:-len(".vtr")] + ".csv")
+    if len(rows) != size:
+        print("%s: %d cells, csv %d rows" % (vtr_file, size, len(rows)))
+        return False
+    for d, (axis, points) in enumerate(zip("xyz", (nx + 1, ny + 1, nz + 1))):
+        faces = arrays.get(axis, [])
+        if len(faces) != points:
+            print("%s: %d coordinates in %s-direction expected" % (vtr_file, points, axis))
+            return False
+        # cell centres lie in the middle of the faces
+        for row in rows:
+            i = int(row[d])
+            centre = row[4 + d]
+            if abs(0.5 * (faces[i] + faces[i + 1]) - centre) > 1e-5 * max(1., abs(centre)):
+                print("%s: %s-coordinates do not match the cell centres" % (vtr_file, axis))
+                return False
+    for v, name in enumerate(VAR_NAMES):
+        values = arrays.get(name)
+        if values is None or len(values) != size:
+            print("%s: array %s missing or of wrong size" % (vtr_file, name))
+            return False
+        for row in rows:
+            index = int(row[3])
+            if values[index] != to_float(row[NUMBER_OF_COORD_COLUMNS + v]):
+                print("%s: %s differs at index %d" % (vtr_file, name, index))
+                return False
+    return True
+
+
+result = 0
+vtr_files = sorted(glob.glob("*.vtr"))
+if len(vtr_files) == 0:
+    print("no vtr files found")
+    sys.exit(1)
+for vtr_file in vtr_files:
+    if not compare(vtr_file):
+        result = 1
+
+pvd_files = glob.glob("*_num.pvd")
+if len(pvd_files) != 1:
+    print("expected one collection *_num.pvd, found %d" % len(pvd_files))
+    sys.exit(1)
+with open(pvd_files[0]) as f:
+    listed = sorted(re.findall(r'file="([^"]*)"', f.read()))
+if listed != vtr_files:
+    print("%s lists %s, written were %s" % (pvd_files[0], listed, vtr_files))
+    result = 1
+
+print("%d vtr files checked" % len(vtr_files))
+sys.exit(result)
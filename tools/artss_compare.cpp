@@ -0,0 +1,186 @@
+/// \file       artss_compare.cpp
+/// \brief      compares two field dumps of the analysis (.bin or .dat files)
+/// \date       Oct 17, 2026
+/// \author     ARTSS developers
+/// \copyright  <2015-2020> Forschungszentrum Juelich GmbH. All rights reserved.
+///
+/// usage: artss_compare <file> <reference> [<tolerance>]
+///
+/// Both files are either binary dumps (dat_format="binary", see BinaryDatFormat.h) or text
+/// files (<field>.dat with one value per line or <field>_inner.dat etc. with index;value per
+/// line). The comparison passes, if |value - reference| <= tolerance * max(1, |reference|)
+/// holds for every cell (default tolerance 1e-6) and, if both files contain indices, the
+/// indices are equal.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "../src/analysis/BinaryDatFormat.h"
+
+struct Dump {
+    std::vector<uint64_t> indices;
+    std::vector<double> values;
+};
+
+// ***************************************************************************************
+/// \brief  reads the values (and indices) of a binary dump
+/// \param  bytes   mapped file
+/// \param  size    size of the file
+/// \param  dump    out: indices and values
+/// \return false, if the file is not a valid binary dump
+// ***************************************************************************************
+bool read_binary(const char *bytes, size_t size, Dump &dump) {
+    BinaryDatFormat::Header header;
+    std::memcpy(&header, bytes, sizeof(header));
+    BinaryDatFormat::header_to_little_endian(header);
+    if (header.version != BinaryDatFormat::version
+        || (header.value_size != sizeof(double) && header.value_size != sizeof(float))) {
+        return false;
+    }
+    size_t number = header.size_inner_list + header.size_obstacle_list + header.size_boundary_list;
+    if (header.index_offset + number * sizeof(uint64_t) > size || header.value_offset + number * header.value_size > size) {
+        return false;
+    }
+    dump.indices.resize(number);
+    std::memcpy(dump.indices.data(), bytes + header.index_offset, number * sizeof(uint64_t));
+    BinaryFormat::to_little_endian(dump.indices.data(), number, sizeof(uint64_t));
+    dump.values.resize(number);
+    for (size_t i = 0; i < number; i++) {
+        if (header.value_size == sizeof(double)) {
+            std::memcpy(&dump.values[i], bytes + header.value_offset + i * sizeof(double), sizeof(double));
+            BinaryFormat::to_little_endian(&dump.values[i], 1, sizeof(double));
+        } else {
+            float value;
+            std::memcpy(&value, bytes + header.value_offset + i * sizeof(float), sizeof(float));
+            BinaryFormat::to_little_endian(&value, 1, sizeof(float));
+            dump.values[i] = value;
+        }
+    }
+    return true;
+}
+
+// ***************************************************************************************
+/// \brief  reads the values (and indices, if given as index;value) of a text dump
+/// \param  bytes   mapped file, ends with a newline
+/// \param  size    size of the file
+/// \param  dump    out: indices and values
+/// \return false, if a line cannot be parsed
+// ***************************************************************************************
+bool read_text(const char *bytes, size_t size, Dump &dump) {
+    const char *end = bytes + size;
+    for (const char *line = bytes; line < end;) {
+        const char *line_end = static_cast<const char *>(std::memchr(line, '\n', static_cast<size_t>(end - line)));
+        const char *separator = static_cast<const char *>(std::memchr(line, ';', static_cast<size_t>(line_end - line)));
+        char *parsed;
+        if (separator != nullptr) {
+            dump.indices.push_back(std::strtoull(line, &parsed, 10));
+            line = separator + 1;
+        }
+        if (line == line_end) {
+            line = line_end + 1;
+            continue;
+        }
+        dump.values.push_back(std::strtod(line, &parsed));
+        if (parsed == line) {
+            return false;
+        }
+        line = line_end + 1;
+    }
+    return dump.indices.empty() || dump.indices.size() == dump.values.size();
+}
+
+// ***************************************************************************************
+/// \brief  maps a file and reads it as binary or text dump
+/// \param  filename    name of the file
+/// \param  dump        out: indices and values
+/// \return false, if the file cannot be read
+// ***************************************************************************************
+bool read(const std::string &filename, Dump &dump) {
+    int fd = open(filename.c_str(), O_RDONLY);
+    struct stat status;
+    if (fd < 0 || fstat(fd, &status) != 0) {
+        fprintf(stderr, "cannot read %s\n", filename.c_str());
+        return false;
+    }
+    size_t size = static_cast<size_t>(status.st_size);
+    if (size == 0) {
+        close(fd);
+        return true;
+    }
+    void *mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        fprintf(stderr, "cannot map %s\n", filename.c_str());
+        return false;
+    }
+    const char *bytes = static_cast<const char *>(mapped);
+
+    bool success;
+    if (size >= sizeof(BinaryDatFormat::Header)
+        && std::memcmp(bytes, BinaryDatFormat::magic, sizeof(BinaryDatFormat::magic)) == 0) {
+        success = read_binary(bytes, size, dump);
+    } else if (bytes[size - 1] == '\n') {
+        success = read_text(bytes, size, dump);
+    } else {
+        // strtod needs a terminating character behind the last value
+        std::string text(bytes, size);
+        text.push_back('\n');
+        success = read_text(text.data(), text.size(), dump);
+    }
+    munmap(mapped, size);
+    if (!success) {
+        fprintf(stderr, "%s is not a valid dump\n", filename.c_str());
+    }
+    return success;
+}
+
+int main(int argc, char **argv) {
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s <file> <reference> [<tolerance>]\n", argv[0]);
+        return 1;
+    }
+    double tolerance = argc > 3 ? std::atof(argv[3]) : 1e-6;
+
+    Dump dump, reference;
+    if (!read(argv[1], dump) || !read(argv[2], reference)) {
+        return 1;
+    }
+    if (dump.values.size() != reference.values.size()) {
+        printf("%s: number of values differs (%zu, reference %zu)\n", argv[1], dump.values.size(),
+               reference.values.size());
+        return 1;
+    }
+    if (!dump.indices.empty() && !reference.indices.empty() && dump.indices != reference.indices) {
+        printf("%s: indices differ from reference\n", argv[1]);
+        return 1;
+    }
+
+    double sum = 0;
+    double max = 0;
+    size_t failed = 0;
+    for (size_t i = 0; i < dump.values.size(); i++) {
+        double difference = std::fabs(dump.values[i] - reference.values[i]);
+        sum += difference;
+        max = std::max(max, difference);
+        // NaN fails as well
+        if (!(difference <= tolerance * std::max(1., std::fabs(reference.values[i])))) {
+            failed++;
+        }
+    }
+    printf("%s: %zu values, sum of differences %g, maximal difference %g\n", argv[1], dump.values.size(), sum, max);
+    if (failed > 0) {
+        printf("%s: %zu values exceed the tolerance %g\n", argv[1], failed, tolerance);
+        return 1;
+    }
+    return 0;
+}
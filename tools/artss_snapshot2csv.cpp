@@ -0,0 +1,133 @@
+/// \file       artss_snapshot2csv.cpp
+/// \brief      converts a binary snapshot (.snap) into the CSV file of the CSVWriter
+/// \date       Oct 17, 2026
+/// \author     ARTSS developers
+/// \copyright  <2015-2020> Forschungszentrum Juelich GmbH. All rights reserved.
+///
+/// usage: artss_snapshot2csv <snapshot.snap> [<output.csv>]
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "../src/visualisation/SnapshotFormat.h"
+
+const static char delimiter = ',';
+
+// ***************************************************************************************
+/// \brief  writes the rows of the CSV file (same format as CSVWriter::csv_write)
+/// \param  output    CSV file
+/// \param  header    header of the snapshot (host byte order)
+/// \param  fields    pointers to the fields in the mapped snapshot
+// ***************************************************************************************
+template<typename T>
+void write_rows(FILE *output, const SnapshotFormat::Header &header, const std::vector<const char *> &fields) {
+    const size_t Nx = header.Nx;
+    const size_t Ny = header.Ny;
+    const size_t Nz = header.Nz;
+    const T X1 = static_cast<T>(header.X1), Y1 = static_cast<T>(header.Y1), Z1 = static_cast<T>(header.Z1);
+    const T dx = static_cast<T>(header.dx), dy = static_cast<T>(header.dy), dz = static_cast<T>(header.dz);
+
+    std::vector<T> values(fields.size());
+    for (size_t k = 0; k < Nz; k++) {
+        for (size_t j = 0; j < Ny; j++) {
+            for (size_t i = 0; i < Nx; i++) {
+                size_t index = i + Nx * j + Nx * Ny * k;
+                // coordinates of the cell centres as in Visual::initialise_grid
+                auto x = static_cast<float>(X1 + (static_cast<T>(i) - 0.5) * dx);
+                auto y = static_cast<float>(Y1 + (static_cast<T>(j) - 0.5) * dy);
+                auto z = static_cast<float>(Z1 + (static_cast<T>(k) - 0.5) * dz);
+                fprintf(output, "%zu%c%zu%c%zu%c%zu%c%.24g%c%.24g%c%.24g", i, delimiter, j, delimiter, k, delimiter,
+                        index, delimiter, x, delimiter, y, delimiter, z);
+                for (size_t f = 0; f < fields.size(); f++) {
+                    T value;
+                    std::memcpy(&value, fields[f] + index * sizeof(T), sizeof(T));
+                    BinaryFormat::to_little_endian(&value, 1, sizeof(T));
+                    fprintf(output, "%c%.24g", delimiter, static_cast<double>(value));
+                }
+                fputc('\n', output);
+            }
+        }
+    }
+}
+
+int main(int argc, char **argv) {
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <snapshot.snap> [<output.csv>]\n", argv[0]);
+        return 1;
+    }
+    std::string input = argv[1];
+    std::string output_name;
+    if (argc > 2) {
+        output_name = argv[2];
+    } else {
+        size_t last_dot = input.find_last_of('.');
+        output_name = (last_dot == std::string::npos ? input : input.substr(0, last_dot)) + ".csv";
+    }
+
+    int fd = open(input.c_str(), O_RDONLY);
+    struct stat status;
+    if (fd < 0 || fstat(fd, &status) != 0 || static_cast<size_t>(status.st_size) < sizeof(SnapshotFormat::Header)) {
+        fprintf(stderr, "cannot read snapshot %s\n", input.c_str());
+        return 1;
+    }
+    size_t file_size = static_cast<size_t>(status.st_size);
+    void *mapped = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        fprintf(stderr, "cannot map snapshot %s\n", input.c_str());
+        return 1;
+    }
+    const char *bytes = static_cast<const char *>(mapped);
+
+    SnapshotFormat::Header header;
+    std::memcpy(&header, bytes, sizeof(header));
+    SnapshotFormat::header_to_little_endian(header);
+    const size_t size = header.Nx * header.Ny * header.Nz;
+    if (std::memcmp(header.magic, SnapshotFormat::magic, sizeof(header.magic)) != 0
+        || header.version != SnapshotFormat::version
+        || (header.value_size != sizeof(double) && header.value_size != sizeof(float))
+        || header.data_offset + header.number_of_fields * size * header.value_size > file_size) {
+        fprintf(stderr, "%s is not a valid snapshot (version %u)\n", input.c_str(), SnapshotFormat::version);
+        munmap(mapped, file_size);
+        return 1;
+    }
+
+    std::vector<const char *> fields;
+    std::vector<std::string> names;
+    for (uint32_t f = 0; f < header.number_of_fields; f++) {
+        const char *name = bytes + sizeof(header) + f * SnapshotFormat::name_length;
+        names.emplace_back(name, strnlen(name, SnapshotFormat::name_length));
+        fields.push_back(bytes + header.data_offset + f * size * header.value_size);
+    }
+
+    FILE *output = fopen(output_name.c_str(), "w");
+    if (output == nullptr) {
+        fprintf(stderr, "cannot write %s\n", output_name.c_str());
+        munmap(mapped, file_size);
+        return 1;
+    }
+    std::vector<char> buffer(1 << 22);
+    setvbuf(output, buffer.data(), _IOFBF, buffer.size());
+
+    fprintf(output, "i%cj%ck%cindex%cx-coords (m)%cy-coords (m)%cz-coords (m)", delimiter, delimiter, delimiter,
+            delimiter, delimiter, delimiter);
+    for (auto &name : names) {
+        fprintf(output, "%c%s", delimiter, name.c_str());
+    }
+    fputc('\n', output);
+
+    if (header.value_size == sizeof(double)) {
+        write_rows<double>(output, header, fields);
+    } else {
+        write_rows<float>(output, header, fields);
+    }
+    fclose(output);
+    munmap(mapped, file_size);
+    return 0;
+}